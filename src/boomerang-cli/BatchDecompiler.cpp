@@ -0,0 +1,349 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BatchDecompiler.h"
+
+#include "boomerang/util/log/Log.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QSet>
+#include <QTextStream>
+#include <QTimer>
+
+#include <algorithm>
+
+
+/// Minimum time a worker is given after the job timeout to finish the job with partial output.
+static const int MIN_GRACE_PERIOD_MS = 60 * 1000;
+
+
+static const char *statusToString(BatchJobStatus status)
+{
+    switch (status) {
+    case BatchJobStatus::Pending: return "pending";
+    case BatchJobStatus::Running: return "running";
+    case BatchJobStatus::Succeeded: return "succeeded";
+    case BatchJobStatus::Failed: return "failed";
+    case BatchJobStatus::TimedOut: return "timed out";
+    case BatchJobStatus::Killed: return "killed";
+    case BatchJobStatus::Crashed: return "crashed";
+    }
+
+    return "unknown";
+}
+
+
+BatchDecompiler::BatchDecompiler(const QStringList &workerArgs, int numWorkers, int jobTimeoutMs,
+                                 QObject *parent)
+    : QObject(parent)
+    , m_workerArgs(workerArgs)
+    , m_numWorkers(std::max(1, numWorkers))
+    , m_jobTimeoutMs(std::max(0, jobTimeoutMs))
+{
+}
+
+
+BatchDecompiler::~BatchDecompiler()
+{
+    for (Worker &worker : m_workers) {
+        if (worker.process && worker.process->state() != QProcess::NotRunning) {
+            worker.process->kill();
+            worker.process->waitForFinished();
+        }
+    }
+}
+
+
+bool BatchDecompiler::readJobFile(const QString &listFile, const QDir &workingDir,
+                                  const QDir &outputDir)
+{
+    QFile file(workingDir.absoluteFilePath(listFile));
+    if (!file.open(QFile::ReadOnly | QFile::Text)) {
+        LOG_ERROR("Cannot open batch file '%1'", file.fileName());
+        return false;
+    }
+
+    QSet<QString> usedOutputDirs;
+    QTextStream ist(&file);
+
+    while (!ist.atEnd()) {
+        const QString line = ist.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith('#')) {
+            continue;
+        }
+
+        const QStringList fields = line.split('\t', QString::SkipEmptyParts);
+        const QFileInfo binaryInfo(workingDir.absoluteFilePath(fields[0].trimmed()));
+
+        BatchJob job;
+        job.binaryPath = binaryInfo.absoluteFilePath();
+
+        const QString requestedDir = QDir::cleanPath(
+            (fields.size() > 1) ? workingDir.absoluteFilePath(fields[1].trimmed())
+                                : outputDir.absoluteFilePath(binaryInfo.baseName()));
+
+        // Jobs run in parallel, so they must not share an output directory
+        // (e.g. binaries with the same name in different directories).
+        job.outputDir = requestedDir;
+        for (int i = 2; usedOutputDirs.contains(job.outputDir); i++) {
+            job.outputDir = requestedDir + QString("_%1").arg(i);
+        }
+
+        if (fields.size() > 1 && job.outputDir != requestedDir) {
+            LOG_WARN("Output directory '%1' is used by multiple binaries; "
+                     "writing output for '%2' to '%3' instead",
+                     requestedDir, job.binaryPath, job.outputDir);
+        }
+
+        usedOutputDirs.insert(job.outputDir);
+        m_jobs.push_back(job);
+    }
+
+    if (m_jobs.empty()) {
+        LOG_ERROR("Batch file '%1' does not contain any binaries", file.fileName());
+        return false;
+    }
+
+    return true;
+}
+
+
+bool BatchDecompiler::run()
+{
+    if (m_jobs.empty()) {
+        return true;
+    }
+
+    m_totalTime.start();
+
+    const int numWorkers = std::min(m_numWorkers, static_cast<int>(m_jobs.size()));
+    m_workers.resize(numWorkers);
+
+    LOG_MSG("Decompiling %1 binaries using %2 worker processes", m_jobs.size(), numWorkers);
+
+    for (int i = 0; i < numWorkers; i++) {
+        if (!startWorker(i)) {
+            return false;
+        }
+    }
+
+    if (m_finishedJobs < static_cast<int>(m_jobs.size()) && !m_workerStartFailed) {
+        m_eventLoop.exec();
+    }
+
+    return !m_workerStartFailed &&
+           std::all_of(m_jobs.begin(), m_jobs.end(), [](const BatchJob &job) {
+               return job.status == BatchJobStatus::Succeeded;
+           });
+}
+
+
+bool BatchDecompiler::writeReport(const QString &reportFile) const
+{
+    QJsonArray jobs;
+    int numSucceeded = 0;
+
+    LOG_MSG("Batch decompilation summary:");
+
+    for (const BatchJob &job : m_jobs) {
+        LOG_MSG("  %1 %2 %3",
+                QString(statusToString(job.status)).leftJustified(10),
+                QString("%1 ms").arg(job.elapsedMs).rightJustified(12), job.binaryPath);
+
+        if (job.status == BatchJobStatus::Succeeded) {
+            numSucceeded++;
+        }
+
+        QJsonObject obj;
+        obj["binary"]     = job.binaryPath;
+        obj["output_dir"] = job.outputDir;
+        obj["status"]     = statusToString(job.status);
+        obj["elapsed_ms"] = static_cast<double>(job.elapsedMs);
+        jobs.append(obj);
+    }
+
+    const qint64 totalMs = m_totalTime.isValid() ? m_totalTime.elapsed() : 0;
+    LOG_MSG("%1 of %2 binaries decompiled successfully in %3 ms", numSucceeded, m_jobs.size(),
+            QString::number(totalMs));
+
+    QJsonObject report;
+    report["jobs"]       = jobs;
+    report["succeeded"]  = numSucceeded;
+    report["failed"]     = static_cast<int>(m_jobs.size()) - numSucceeded;
+    report["elapsed_ms"] = static_cast<double>(totalMs);
+
+    QFile file(reportFile);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        LOG_ERROR("Cannot write batch report to '%1'", reportFile);
+        return false;
+    }
+
+    file.write(QJsonDocument(report).toJson());
+    LOG_MSG("Batch report written to '%1'", reportFile);
+    return true;
+}
+
+
+bool BatchDecompiler::startWorker(int workerIdx)
+{
+    Worker &worker    = m_workers[workerIdx];
+    worker.currentJob = -1;
+
+    if (!worker.jobTimer) {
+        worker.jobTimer.reset(new QTimer());
+        worker.jobTimer->setSingleShot(true);
+        connect(worker.jobTimer.get(), &QTimer::timeout, this,
+                [this, workerIdx]() { onJobTimeout(workerIdx); });
+    }
+
+    if (worker.process) {
+        worker.process->deleteLater();
+    }
+
+    worker.process = new QProcess(this);
+    worker.process->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+
+    connect(worker.process, &QProcess::readyReadStandardOutput, this,
+            [this, workerIdx]() { onWorkerOutput(workerIdx); });
+    connect(worker.process,
+            static_cast<void (QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished), this,
+            [this, workerIdx]() { onWorkerFinished(workerIdx); });
+
+    worker.process->start(QCoreApplication::applicationFilePath(),
+                          m_workerArgs + QStringList{ "--batch-worker" });
+
+    if (!worker.process->waitForStarted()) {
+        LOG_ERROR("Cannot start worker process: %1", worker.process->errorString());
+        m_workerStartFailed = true;
+        m_eventLoop.quit();
+        return false;
+    }
+
+    dispatchNextJob(workerIdx);
+    return true;
+}
+
+
+void BatchDecompiler::dispatchNextJob(int workerIdx)
+{
+    Worker &worker = m_workers[workerIdx];
+
+    if (!hasPendingJobs()) {
+        // no more work; the worker exits when its stdin is closed
+        worker.process->closeWriteChannel();
+        return;
+    }
+
+    const int jobIdx  = m_nextJob++;
+    BatchJob &job     = m_jobs[jobIdx];
+    job.status        = BatchJobStatus::Running;
+    worker.currentJob = jobIdx;
+
+    LOG_MSG("[%1/%2] Decompiling '%3'", jobIdx + 1, m_jobs.size(), job.binaryPath);
+
+    const QString request = QString("%1\t%2\t%3\n").arg(jobIdx).arg(job.binaryPath, job.outputDir);
+    worker.process->write(request.toUtf8());
+
+    worker.elapsed.start();
+    if (m_jobTimeoutMs > 0) {
+        // The worker stops decompiling by itself after the timeout and generates code
+        // for the procedures it completed. Only kill it if that takes too long as well.
+        worker.jobTimer->start(m_jobTimeoutMs + std::max(m_jobTimeoutMs, MIN_GRACE_PERIOD_MS));
+    }
+}
+
+
+void BatchDecompiler::finishJob(int workerIdx, BatchJobStatus status)
+{
+    Worker &worker = m_workers[workerIdx];
+    if (worker.currentJob < 0) {
+        return;
+    }
+
+    worker.jobTimer->stop();
+
+    BatchJob &job     = m_jobs[worker.currentJob];
+    job.status        = status;
+    job.elapsedMs     = worker.elapsed.elapsed();
+    worker.currentJob = -1;
+
+    if (status != BatchJobStatus::Succeeded) {
+        LOG_WARN("Decompiling '%1' %2", job.binaryPath, statusToString(status));
+    }
+
+    if (++m_finishedJobs == static_cast<int>(m_jobs.size())) {
+        m_eventLoop.quit();
+    }
+}
+
+
+void BatchDecompiler::onWorkerOutput(int workerIdx)
+{
+    Worker &worker = m_workers[workerIdx];
+
+    while (worker.process->canReadLine()) {
+        const QString line       = QString::fromUtf8(worker.process->readLine()).trimmed();
+        const QStringList fields = line.split('\t');
+
+        bool idxOk = false, codeOk = false;
+        const int jobIdx   = fields.size() == 2 ? fields[0].toInt(&idxOk) : -1;
+        const int exitCode = fields.size() == 2 ? fields[1].toInt(&codeOk) : -1;
+
+        if (!idxOk || !codeOk || jobIdx != worker.currentJob) {
+            continue; // not a reply to the current job
+        }
+
+        switch (exitCode) {
+        case 0: finishJob(workerIdx, BatchJobStatus::Succeeded); break;
+        case 3: finishJob(workerIdx, BatchJobStatus::TimedOut); break;
+        default: finishJob(workerIdx, BatchJobStatus::Failed); break;
+        }
+
+        dispatchNextJob(workerIdx);
+    }
+}
+
+
+void BatchDecompiler::onWorkerFinished(int workerIdx)
+{
+    // The worker died while working on a job, most likely due to a crash in the decompiler.
+    // Replace it to process the remaining jobs.
+    finishJob(workerIdx, BatchJobStatus::Crashed);
+
+    if (hasPendingJobs()) {
+        startWorker(workerIdx);
+    }
+}
+
+
+void BatchDecompiler::onJobTimeout(int workerIdx)
+{
+    Worker &worker = m_workers[workerIdx];
+    if (worker.currentJob < 0) {
+        return;
+    }
+
+    // The worker did not finish within the grace period after its own timeout
+    // (e.g. it is stuck in code generation), so abort the job by killing the worker.
+    finishJob(workerIdx, BatchJobStatus::Killed);
+
+    worker.process->disconnect(this);
+    worker.process->kill();
+    worker.process->waitForFinished();
+
+    if (hasPendingJobs()) {
+        startWorker(workerIdx);
+    }
+}
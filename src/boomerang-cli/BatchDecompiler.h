@@ -0,0 +1,141 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QObject>
+#include <QStringList>
+
+#include <memory>
+#include <vector>
+
+
+class QProcess;
+class QTimer;
+
+
+enum class BatchJobStatus
+{
+    Pending,
+    Running,
+    Succeeded,
+    Failed,   ///< The worker reported a failure (e.g. the binary could not be loaded)
+    TimedOut, ///< The job exceeded the job timeout; output is incomplete
+    Killed,   ///< The job did not finish within the grace period after the timeout
+    Crashed   ///< The worker process terminated unexpectedly while processing the job
+};
+
+
+struct BatchJob
+{
+    QString binaryPath;
+    QString outputDir;
+    BatchJobStatus status = BatchJobStatus::Pending;
+    qint64 elapsedMs      = 0;
+};
+
+
+/**
+ * Decompiles a list of binaries using a pool of worker processes.
+ *
+ * Plugins (and with them the SSL files and library signature catalogs) are
+ * process-wide singletons holding state of the currently loaded program,
+ * so jobs cannot be run in parallel within a single process.
+ * Instead, each worker is a boomerang-cli process started with the --batch-worker switch
+ * that loads all plugins once and then decompiles the jobs it is given one after another.
+ * The job timeout is passed on to the workers (-S), which stop decompiling by themselves
+ * and generate code for all completely decompiled procedures, like boomerang-cli does.
+ * Only if a worker does not finish the job within a grace period after the timeout,
+ * it is killed and a new worker is started in its place for the remaining jobs.
+ *
+ * Communication with the workers uses one line per job:
+ *  - to the worker (stdin):    "<job index>\t<binary path>\t<output directory>"
+ *  - from the worker (stdout): "<job index>\t<exit code>"
+ */
+class BatchDecompiler : public QObject
+{
+    Q_OBJECT
+
+    struct Worker
+    {
+        QProcess *process = nullptr;
+        std::unique_ptr<QTimer> jobTimer; ///< fires when the grace period of the job is over
+        QElapsedTimer elapsed;            ///< time since the current job was started
+        int currentJob = -1;              ///< index of the current job, or -1 if idle
+    };
+
+public:
+    /**
+     * \param workerArgs    command line switches passed to each worker process.
+     * \param numWorkers    maximum number of jobs processed in parallel.
+     * \param jobTimeoutMs  timeout of a single job in milliseconds, or 0 for no timeout.
+     *                      The same timeout must be passed to the workers in \p workerArgs.
+     */
+    BatchDecompiler(const QStringList &workerArgs, int numWorkers, int jobTimeoutMs,
+                    QObject *parent = nullptr);
+    BatchDecompiler(const BatchDecompiler &other) = delete;
+    BatchDecompiler(BatchDecompiler &&other)      = delete;
+
+    ~BatchDecompiler() override;
+
+    BatchDecompiler &operator=(const BatchDecompiler &other) = delete;
+    BatchDecompiler &operator=(BatchDecompiler &&other) = delete;
+
+public:
+    /**
+     * Read the list of binaries to decompile from \p listFile.
+     * Each line contains the path to a binary, optionally followed by a tab character and
+     * the output directory for the binary. Empty lines and lines starting with '#' are ignored.
+     * Relative binary paths are relative to \p workingDir; the default output directory
+     * for each binary is a subdirectory of \p outputDir named after the binary.
+     *
+     * \returns true iff the list file was read successfully and contains at least one binary.
+     */
+    bool readJobFile(const QString &listFile, const QDir &workingDir, const QDir &outputDir);
+
+    /**
+     * Decompile all binaries. Blocks until all jobs are finished.
+     * \returns true iff all jobs succeeded.
+     */
+    bool run();
+
+    /// Log a summary of all jobs and write it to \p reportFile in JSON format.
+    bool writeReport(const QString &reportFile) const;
+
+    const std::vector<BatchJob> &getJobs() const { return m_jobs; }
+
+private:
+    bool startWorker(int workerIdx);
+    void dispatchNextJob(int workerIdx);
+    void finishJob(int workerIdx, BatchJobStatus status);
+
+    void onWorkerOutput(int workerIdx);
+    void onWorkerFinished(int workerIdx);
+    void onJobTimeout(int workerIdx);
+
+    bool hasPendingJobs() const { return m_nextJob < static_cast<int>(m_jobs.size()); }
+
+private:
+    QStringList m_workerArgs;
+    int m_numWorkers;
+    int m_jobTimeoutMs;
+
+    std::vector<BatchJob> m_jobs;
+    std::vector<Worker> m_workers;
+    int m_nextJob      = 0; ///< index of the next job to dispatch
+    int m_finishedJobs = 0;
+    bool m_workerStartFailed = false;
+
+    QElapsedTimer m_totalTime;
+    QEventLoop m_eventLoop;
+};
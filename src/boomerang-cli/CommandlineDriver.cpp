@@ -9,13 +9,17 @@
 #pragma endregion License
 #include "CommandlineDriver.h"
 
+#include "boomerang-cli/BatchDecompiler.h"
+
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/util/CFGDotWriter.h"
+#include "boomerang/util/log/FileLogSink.h"
 #include "boomerang/util/log/Log.h"
 
 #include <QCoreApplication>
 #include <QTextStream>
+#include <QThread>
 
 #include <iostream>
 
@@ -27,13 +31,18 @@ CommandlineDriver::CommandlineDriver(QObject *_parent)
     : QObject(_parent)
     , m_project(new Project())
     , m_debugger(new MiniDebugger())
-    , m_kill_timer(this)
 {
-    this->connect(&m_kill_timer, &QTimer::timeout, this, &CommandlineDriver::onCompilationTimeout);
     m_project->addWatcher(m_debugger.get());
 }
 
 
+CommandlineDriver::~CommandlineDriver()
+{
+    // m_debugger is destroyed before m_project
+    m_project->removeWatcher(m_debugger.get());
+}
+
+
 /**
  * Prints help about the command line switches.
  */
@@ -43,6 +52,7 @@ static void help()
     std::cout <<
 "Usage:\n"
 "  boomerang-cli [ switches ] [ -- ] program\n"
+"  boomerang-cli [ switches ] --batch <list_file>\n"
 "  boomerang-cli -i [ command_file ]\n"
 "  boomerang-cli ( -h | --help | --version )\n"
 "\n"
@@ -58,9 +68,20 @@ static void help()
 "  -E <addr>        : Equivalent to -nc -e <addr>\n"
 "  -ic              : Decode through type 0 Indirect Calls\n"
 "  -S <min>         : Stop decompilation after specified number of minutes\n"
+"                     and generate code for all completely decompiled procedures\n"
+"                     (in batch mode: per binary)\n"
+"  --proc-time <s>  : Finish procedures taking longer than <s> seconds\n"
+"                     with a reduced pipeline (e.g. no type analysis)\n"
+"  --proc-stmts <n> : Finish procedures with more than <n> statements\n"
+"                     with a reduced pipeline\n"
 "  -t               : Trace (print address of) every instruction decoded\n"
 "  -a               : Assume ABI compliance\n"
 "\n"
+"Batch mode\n"
+"  --batch <file>   : Decompile all binaries listed in <file>, one per line.\n"
+"                     Output is written to a subdirectory of the output path per binary\n"
+"  --jobs <n>       : Decompile <n> binaries in parallel (defaults to the number of CPUs)\n"
+"\n"
 "Output\n"
 "  --version        : Print version information and exit\n"
 "  -h, --help       : Show this help and exit\n"
@@ -114,6 +135,7 @@ static void usage()
     std::cout <<
 "Usage:\n"
 "  boomerang-cli [ switches ] [ -- ] program\n"
+"  boomerang-cli [ switches ] --batch <list_file>\n"
 "  boomerang-cli -i [ command_file ]\n"
 "  boomerang-cli ( -h | --help | --version )\n";
     // clang-format on
@@ -135,7 +157,9 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
     }
 
     for (int i = 1; i < args.size(); ++i) {
-        QString arg = args[i];
+        QString arg          = args[i];
+        const int firstArg   = i;
+        bool forwardToWorker = true; // forward this switch to batch worker processes
 
         if (arg[0] != '-') {
             if (i == args.size() - 1) {
@@ -201,6 +225,8 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
             break;
 
         case 'o': {
+            forwardToWorker = false; // each batch job has its own output directory
+
             QString o_path = args[++i];
 
             if (!o_path.endsWith('/') && !o_path.endsWith('\\')) {
@@ -228,6 +254,63 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
                 m_project->getSettings()->sslFileName = args[++i];
                 break;
             }
+            else if (arg == "--proc-time" || arg == "--proc-stmts") {
+                if (++i == args.size()) {
+                    usage();
+                    return 1;
+                }
+
+                bool converted   = false;
+                const int budget = args[i].toInt(&converted);
+
+                if (!converted || budget <= 0) {
+                    LOG_ERROR("Bad budget for %1: %2", arg, args[i]);
+                    usage();
+                    return 1;
+                }
+
+                if (arg == "--proc-time") {
+                    m_project->getSettings()->procTimeBudget = budget;
+                }
+                else {
+                    m_project->getSettings()->procStmtBudget = budget;
+                }
+                break;
+            }
+            else if (arg == "--batch") {
+                if (++i == args.size()) {
+                    usage();
+                    return 1;
+                }
+
+                m_batchFile     = args[i];
+                forwardToWorker = false;
+                break;
+            }
+            else if (arg == "--jobs") {
+                if (++i == args.size()) {
+                    usage();
+                    return 1;
+                }
+
+                bool converted    = false;
+                const int numJobs = args[i].toInt(&converted);
+
+                if (!converted || numJobs <= 0) {
+                    LOG_ERROR("Bad number of jobs: %1", args[i]);
+                    usage();
+                    return 1;
+                }
+
+                m_numBatchJobs  = numJobs;
+                forwardToWorker = false;
+                break;
+            }
+            else if (arg == "--batch-worker") {
+                m_isBatchWorker = true;
+                forwardToWorker = false;
+                break;
+            }
             break;
 
         case 'i':
@@ -241,6 +324,7 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
             }
             else { // -i
                 interactiveMode = true;
+                forwardToWorker = false;
 
                 if ((i + 1 < args.size()) && !args[i + 1].startsWith("-")) {
                     m_project->getSettings()->replayFile = args[++i];
@@ -347,20 +431,23 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
             m_project->getSettings()->propMaxDepth = args[i].toInt();
             break;
 
-        case 'S': minsToStopAfter = args[++i].toInt(); break;
+        case 'S':
+            minsToStopAfter = args[++i].toInt();
+            break;
 
         default: help();
         }
+
+        if (forwardToWorker) {
+            m_workerArgs.append(args.mid(firstArg, i - firstArg + 1));
+        }
     }
 
     if (interactiveMode) {
         return interactiveMain();
     }
-
-    if (minsToStopAfter > 0) {
-        LOG_MSG("Stopping decompile after %1 minutes", minsToStopAfter);
-        m_kill_timer.setSingleShot(true);
-        m_kill_timer.start(1000 * 60 * minsToStopAfter);
+    else if (m_isBatchWorker || !m_batchFile.isEmpty()) {
+        return 0;
     }
 
     m_pathToBinary = args.last();
@@ -403,6 +490,13 @@ int CommandlineDriver::interactiveMain()
 
 int CommandlineDriver::decompile()
 {
+    if (m_isBatchWorker) {
+        return batchWorkerMain();
+    }
+    else if (!m_batchFile.isEmpty()) {
+        return batchMain();
+    }
+
     Log::getOrCreateLog().addDefaultLogSinks(
         m_project->getSettings()->getOutputDirectory().absolutePath());
     m_project->loadPlugins();
@@ -414,10 +508,67 @@ int CommandlineDriver::decompile()
 }
 
 
-void CommandlineDriver::onCompilationTimeout()
+int CommandlineDriver::batchMain()
 {
-    LOG_WARN("Compilation timed out, Boomerang will now exit");
-    exit(1);
+    QDir outputDir = m_project->getSettings()->getOutputDirectory();
+    outputDir.mkpath(".");
+
+    Log::getOrCreateLog().addDefaultLogSinks(outputDir.absolutePath());
+
+    const int numJobs = m_numBatchJobs > 0 ? m_numBatchJobs : QThread::idealThreadCount();
+    BatchDecompiler batch(m_workerArgs, numJobs, 1000 * 60 * minsToStopAfter);
+
+    if (!batch.readJobFile(m_batchFile, m_project->getSettings()->getWorkingDirectory(),
+                           outputDir)) {
+        return 1;
+    }
+
+    const bool allSucceeded = batch.run();
+    batch.writeReport(outputDir.absoluteFilePath("batch-summary.json"));
+
+    return allSucceeded ? 0 : 1;
+}
+
+
+int CommandlineDriver::batchWorkerMain()
+{
+    // stdout is used to report results to the batch decompiler, so do not log to the console,
+    // and there is nobody to answer debug point prompts.
+    m_project->getSettings()->stopAtDebugPoints = false;
+    m_project->loadPlugins();
+
+    QTextStream in(stdin);
+    QTextStream out(stdout);
+
+    while (!in.atEnd()) {
+        const QStringList job = in.readLine().split('\t');
+        if (job.size() != 3) {
+            continue;
+        }
+
+        QDir outDir(job[2]);
+        int result = 1;
+
+        if (outDir.mkpath(".")) {
+            m_project->getSettings()->setOutputDirectory(outDir.absolutePath() + "/");
+
+            Log::getOrCreateLog().removeAllSinks();
+            Log::getOrCreateLog().addLogSink(
+                std::make_unique<FileLogSink>(outDir.absoluteFilePath("boomerang.log")));
+
+            const QFileInfo inf(job[1]);
+            result = decompile(inf.absoluteFilePath(), inf.baseName());
+
+            m_project->unloadBinaryFile();
+            Log::getOrCreateLog().flush();
+        }
+
+        out << job[0] << '\t' << result << '\n';
+        out.flush();
+    }
+
+    Log::getOrCreateLog().removeAllSinks();
+    return 0;
 }
 
 
@@ -444,6 +595,13 @@ int CommandlineDriver::decompile(const QString &fname, const QString &pname)
     time_t start;
     time(&start);
 
+    m_project->getCancellationToken().reset();
+
+    if (minsToStopAfter > 0) {
+        LOG_MSG("Stopping decompile after %1 minutes", minsToStopAfter);
+        m_project->getCancellationToken().setTimeout(std::chrono::minutes(minsToStopAfter));
+    }
+
     if (!loadAndDecode(fname, pname)) {
         return 1;
     }
@@ -456,6 +614,12 @@ int CommandlineDriver::decompile(const QString &fname, const QString &pname)
     LOG_MSG("Decompiling...");
     m_project->decompileBinaryFile();
 
+    // The time limit only applies to decompilation. Clear it if it did not expire yet,
+    // so a complete decompilation is not reported as timed out after code generation.
+    if (!m_project->getCancellationToken().isCancelled()) {
+        m_project->getCancellationToken().reset();
+    }
+
     if (!m_project->getSettings()->dotFile.isEmpty()) {
         CFGDotWriter().writeCFG(m_project->getProg(), m_project->getSettings()->dotFile);
     }
@@ -471,6 +635,13 @@ int CommandlineDriver::decompile(const QString &fname, const QString &pname)
     int mins  = static_cast<int>((end - start) / 60 - hours * 60);
     int secs  = static_cast<int>((end - start) - (hours * 60 * 60) - (mins * 60));
 
+    if (m_project->getCancellationToken().isCancelled()) {
+        LOG_WARN("Decompilation timed out after %1 hours %2 minutes %3 seconds; "
+                 "output is incomplete.",
+                 hours, mins, secs);
+        return 3;
+    }
+
     LOG_MSG("Completed in %1 hours %2 minutes %3 seconds.", hours, mins, secs);
     return 0;
 }
@@ -16,7 +16,7 @@
 #include "boomerang/core/Project.h"
 
 #include <QObject>
-#include <QTimer>
+#include <QStringList>
 
 
 class CommandlineDriver : public QObject
@@ -25,6 +25,7 @@ class CommandlineDriver : public QObject
 
 public:
     explicit CommandlineDriver(QObject *parent = nullptr);
+    ~CommandlineDriver() override;
 
 public:
     int applyCommandline(const QStringList &args);
@@ -39,6 +40,20 @@ public:
     int interactiveMain();
 
 private:
+    /**
+     * Decompiles all binaries listed in the batch file using parallel worker processes.
+     * \returns Zero if all binaries were decompiled successfully, nonzero otherwise.
+     */
+    int batchMain();
+
+    /**
+     * Main loop of a batch worker process. Reads jobs from stdin, one per line,
+     * and decompiles them one after another, reusing the loaded plugins.
+     * For each finished job, the job index and the result is written to stdout.
+     * \sa BatchDecompiler
+     */
+    int batchWorkerMain();
+
     /**
      * Loads the executable file and decodes it.
      * \param fname The name of the file to load.
@@ -53,19 +68,23 @@ private:
      * \param fname The name of the file to load.
      * \param pname The name that will be given to the Proc.
      *
-     * \return Zero on success, nonzero on faillure.
+     * \retval 0 success.
+     * \retval 3 The time limit (-S) was exceeded; code was only generated for procedures
+     *           that were decompiled completely.
+     * \return other nonzero values on failure.
      */
     int decompile(const QString &fname, const QString &pname);
 
-public slots:
-    void onCompilationTimeout();
-
 private:
     std::unique_ptr<Project> m_project;
     std::unique_ptr<Console> m_console;
     std::unique_ptr<MiniDebugger> m_debugger;
 
-    QTimer m_kill_timer;
     int minsToStopAfter = 0;
     QString m_pathToBinary;
+
+    QString m_batchFile;          ///< List of binaries to decompile in batch mode
+    int m_numBatchJobs   = 0;     ///< Number of binaries decompiled in parallel; 0 = number of CPUs
+    bool m_isBatchWorker = false; ///< true if this process is a worker of a batch decompilation
+    QStringList m_workerArgs;     ///< Command line switches forwarded to batch worker processes
 };
@@ -228,10 +228,24 @@ CommandStatus Console::handleDecompile(const QStringList &args)
         return CommandStatus::Success;
     }
     else {
-        // decompile all specified procedures
+        // decompile all specified procedures.
+        // With -s, the procedures are decompiled first, with summaries of their callees.
+        QStringList procNames = args;
+        const bool summarize  = procNames.front() == "-s";
+
+        if (summarize) {
+            procNames.removeFirst();
+
+            if (procNames.empty()) {
+                std::cerr << "Wrong number of arguments for command; Expected at least 2, got 1."
+                          << std::endl;
+                return CommandStatus::ParseError;
+            }
+        }
+
         ProcSet procSet;
 
-        for (const QString &procName : args) {
+        for (const QString &procName : procNames) {
             Function *proc = prog->getFunctionByName(procName);
 
             if (proc == nullptr) {
@@ -250,11 +264,21 @@ CommandStatus Console::handleDecompile(const QStringList &args)
             procSet.insert(userProc);
         }
 
+        if (!summarize) {
+            for (UserProc *userProc : procSet) {
+                userProc->decompileRecursive();
+            }
+
+            return CommandStatus::Success;
+        }
+
+        // The summarized callees are not decompiled.
+        bool ok = true;
         for (UserProc *userProc : procSet) {
-            userProc->decompileRecursive();
+            ok &= m_project->decompileProc(userProc);
         }
 
-        return CommandStatus::Success;
+        return ok ? CommandStatus::Success : CommandStatus::Failure;
     }
 }
 
@@ -871,6 +895,9 @@ CommandStatus Console::handleHelp(const QStringList &args)
            "  decode <file>                      : Loads and decodes the specified binary.\n"
            "  decompile [<proc1> [<proc2>...]]   : Decompiles the program or specified "
            "function(s).\n"
+           "  decompile -s <proc1> [<proc2>...]  : Decompiles only the specified function(s), "
+           "using\n"
+           "                                       summaries of their callees.\n"
            "  codegen [<module1> [<module2>...]] : Generates code for the program or a specified "
            "module.\n"
            "  info prog                          : Print information about the program.\n"
@@ -25,8 +25,6 @@
 #include "boomerang/ssl/type/NamedType.h"
 #include "boomerang/util/log/Log.h"
 
-#include <QThread>
-
 
 Decompiler::Decompiler()
     : QObject()
@@ -41,6 +39,7 @@ Decompiler::Decompiler()
 
 Decompiler::~Decompiler()
 {
+    m_project.removeWatcher(this);
 }
 
 
@@ -130,6 +129,41 @@ void Decompiler::decompile()
 }
 
 
+void Decompiler::decompileProc(const QString &procName)
+{
+    Prog *prog = m_project.getProg();
+    if (prog == nullptr) {
+        LOG_WARN("Cannot decompile '%1': No binary file is loaded.", procName);
+        return;
+    }
+
+    UserProc *proc = dynamic_cast<UserProc *>(prog->getFunctionByName(procName));
+    if (proc == nullptr) {
+        LOG_WARN("Cannot decompile '%1': Not a user procedure.", procName);
+        return;
+    }
+
+    if (m_project.decompileProc(proc) && m_project.generateCode(proc->getModule(), proc)) {
+        emit procCodeGenerated(procName, proc->getModule()->getOutPath("c"));
+    }
+
+    if (!m_refinementScheduled) {
+        m_refinementScheduled = true;
+        QMetaObject::invokeMethod(this, "refineCallees", Qt::QueuedConnection);
+    }
+}
+
+
+void Decompiler::refineCallees()
+{
+    m_refinementScheduled = m_project.refineCallees();
+
+    if (m_refinementScheduled) {
+        QMetaObject::invokeMethod(this, "refineCallees", Qt::QueuedConnection);
+    }
+}
+
+
 void Decompiler::moduleAndChildrenUpdated(Module *root)
 {
     emit moduleCreated(root->getName());
@@ -180,6 +214,18 @@ void Decompiler::onDecompileInProgress(UserProc *p)
 }
 
 
+void Decompiler::onDecodeProgress(int numInstructions, int numBytes)
+{
+    emit decodeProgress(numInstructions, numBytes);
+}
+
+
+void Decompiler::onDecompileProgress(int numProcsDecompiled)
+{
+    emit decompileProgress(numProcsDecompiled);
+}
+
+
 void Decompiler::onFunctionCreated(Function *function)
 {
     if (function->isLib()) {
@@ -246,11 +292,12 @@ void Decompiler::onDecompileDebugPoint(UserProc *proc, const char *description)
     LOG_VERBOSE("%1: %2", proc->getName(), description);
 
     if (m_debugging) {
+        QMutexLocker lock(&m_debugPointMutex);
         m_waiting = true;
         emit debugPointHit(proc->getName(), description);
 
         while (m_waiting) {
-            QThread::yieldCurrentThread();
+            m_debugPointCondition.wait(&m_debugPointMutex);
         }
     }
 }
@@ -258,7 +305,9 @@ void Decompiler::onDecompileDebugPoint(UserProc *proc, const char *description)
 
 void Decompiler::stopWaiting()
 {
+    QMutexLocker lock(&m_debugPointMutex);
     m_waiting = false;
+    m_debugPointCondition.wakeAll();
 }
 
 
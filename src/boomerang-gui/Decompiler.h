@@ -12,9 +12,13 @@
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Watcher.h"
 
+#include <QMutex>
 #include <QObject>
 #include <QString>
 #include <QTableWidget>
+#include <QWaitCondition>
+
+#include <atomic>
 
 
 class Module;
@@ -42,6 +46,8 @@ public:
     virtual void onDecompileDebugPoint(UserProc *proc, const char *description) override;
     virtual void onFunctionDiscovered(Function *function) override;
     virtual void onDecompileInProgress(UserProc *function) override;
+    virtual void onDecodeProgress(int numInstructions, int numBytes) override;
+    virtual void onDecompileProgress(int numProcsDecompiled) override;
     virtual void onFunctionCreated(Function *function) override;
     virtual void onFunctionRemoved(Function *function) override;
     virtual void onSignatureUpdated(Function *function) override;
@@ -55,10 +61,13 @@ signals: // Decompiler -> ui
     void loadCompleted();
     void decodeCompleted();
     void decompileCompleted();
+    void procCodeGenerated(const QString &procName, const QString &codeFile);
     void generateCodeCompleted();
 
     void procDiscovered(const QString &callerName, const QString &procName);
     void procDecompileStarted(const QString &procName);
+    void decodeProgress(int numInstructions, int numBytes);
+    void decompileProgress(int numProcsDecompiled);
 
     void userProcCreated(const QString &name, Address entryAddr);
     void libProcCreated(const QString &name, const QString &params);
@@ -79,6 +88,14 @@ public slots: // ui -> Decompiler
     void decompile();
     void generateCode();
 
+    /// Decompile only the procedure \p procName, using summaries for its callees,
+    /// and generate code for it. The callees are refined afterwards by refineCallees().
+    void decompileProc(const QString &procName);
+
+    /// Decompile the next callee queued for refinement. Re-schedules itself
+    /// until all callees are refined, so that requests by the user are handled in between.
+    void refineCallees();
+
     void stopWaiting();
     void rereadLibSignatures();
 
@@ -101,10 +118,17 @@ private:
     void moduleAndChildrenUpdated(Module *root);
 
 protected:
-    bool m_debugging = false;
-    bool m_waiting   = false;
+    std::atomic<bool> m_debugging{ false };
+
+    /// The decompiler thread sleeps on m_debugPointCondition while waiting at a debug point.
+    bool m_waiting = false;
+    QMutex m_debugPointMutex;
+    QWaitCondition m_debugPointCondition;
 
     Project m_project;
 
+    /// True if refineCallees() is queued on the decompiler thread.
+    bool m_refinementScheduled = false;
+
     std::vector<Address> m_userEntrypoints;
 };
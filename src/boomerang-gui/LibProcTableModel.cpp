@@ -0,0 +1,140 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "LibProcTableModel.h"
+
+
+LibProcTableModel::LibProcTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+    , m_flushTimer(this)
+{
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(100);
+    connect(&m_flushTimer, &QTimer::timeout, this, &LibProcTableModel::flushPendingProcs);
+}
+
+
+int LibProcTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(m_rows.size());
+}
+
+
+int LibProcTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : NumColumns;
+}
+
+
+QVariant LibProcTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= static_cast<int>(m_rows.size()) ||
+        role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    const ProcRow &row = m_rows[index.row()];
+
+    switch (index.column()) {
+    case ColName: return row.name;
+    case ColParams: return row.params;
+    }
+
+    return QVariant();
+}
+
+
+QVariant LibProcTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    switch (section) {
+    case ColName: return tr("Name");
+    case ColParams: return tr("Parameters");
+    }
+
+    return QVariant();
+}
+
+
+void LibProcTableModel::addProc(const QString &name, const QString &params)
+{
+    const int existingRow = m_rowByName.value(name, -1);
+    const int numRows     = static_cast<int>(m_rows.size());
+
+    if (existingRow >= numRows) {
+        m_pendingRows[existingRow - numRows].params = params;
+        return;
+    }
+    else if (existingRow >= 0) {
+        m_rows[existingRow].params = params;
+        emit dataChanged(index(existingRow, ColParams), index(existingRow, ColParams));
+        return;
+    }
+
+    m_rowByName.insert(name, numRows + static_cast<int>(m_pendingRows.size()));
+    m_pendingRows.push_back({ name, params });
+
+    if (!m_flushTimer.isActive()) {
+        m_flushTimer.start();
+    }
+}
+
+
+void LibProcTableModel::removeProc(const QString &name)
+{
+    flushPendingProcs();
+
+    const int row = m_rowByName.value(name, -1);
+    if (row < 0) {
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row);
+    m_rowByName.remove(name);
+    m_rows.erase(m_rows.begin() + row);
+
+    for (int i = row; i < static_cast<int>(m_rows.size()); i++) {
+        m_rowByName[m_rows[i].name] = i;
+    }
+
+    endRemoveRows();
+}
+
+
+void LibProcTableModel::clear()
+{
+    m_flushTimer.stop();
+
+    beginResetModel();
+    m_rows.clear();
+    m_pendingRows.clear();
+    m_rowByName.clear();
+    endResetModel();
+}
+
+
+void LibProcTableModel::flushPendingProcs()
+{
+    m_flushTimer.stop();
+
+    if (m_pendingRows.empty()) {
+        return;
+    }
+
+    const int first = static_cast<int>(m_rows.size());
+    const int last  = first + static_cast<int>(m_pendingRows.size()) - 1;
+
+    beginInsertRows(QModelIndex(), first, last);
+    m_rows.insert(m_rows.end(), m_pendingRows.begin(), m_pendingRows.end());
+    m_pendingRows.clear();
+    endInsertRows();
+}
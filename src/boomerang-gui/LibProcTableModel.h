@@ -0,0 +1,88 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QTimer>
+
+#include <vector>
+
+
+/**
+ * Table model of all library procedures of the program (name, parameters).
+ * Like UserProcTableModel, new procedures are inserted in batches.
+ */
+class LibProcTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        ColName   = 0,
+        ColParams = 1,
+        NumColumns
+    };
+
+public:
+    explicit LibProcTableModel(QObject *parent = nullptr);
+    LibProcTableModel(const LibProcTableModel &other) = delete;
+    LibProcTableModel(LibProcTableModel &&other)      = delete;
+
+    ~LibProcTableModel() override = default;
+
+    LibProcTableModel &operator=(const LibProcTableModel &other) = delete;
+    LibProcTableModel &operator=(LibProcTableModel &&other) = delete;
+
+public:
+    /// \copydoc QAbstractTableModel::rowCount
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractTableModel::columnCount
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractTableModel::data
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /// \copydoc QAbstractTableModel::headerData
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+public:
+    /// Add a new procedure, or update the parameters of an existing procedure.
+    void addProc(const QString &name, const QString &params);
+
+    /// Remove the procedure named \p name.
+    void removeProc(const QString &name);
+
+    /// Remove all procedures.
+    void clear();
+
+    /// Insert all procedures that have been added but are not yet part of the model.
+    void flushPendingProcs();
+
+private:
+    struct ProcRow
+    {
+        QString name;
+        QString params;
+    };
+
+private:
+    std::vector<ProcRow> m_rows;
+    std::vector<ProcRow> m_pendingRows; ///< Procs added, but not yet inserted into the model
+
+    /// Index into m_rows and m_pendingRows (offset by m_rows.size())
+    QHash<QString, int> m_rowByName;
+
+    QTimer m_flushTimer;
+};
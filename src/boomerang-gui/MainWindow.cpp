@@ -10,8 +10,10 @@
 #include "MainWindow.h"
 
 #include "boomerang-gui/Decompiler.h"
+#include "boomerang-gui/LibProcTableModel.h"
 #include "boomerang-gui/RTLEditor.h"
 #include "boomerang-gui/SettingsDlg.h"
+#include "boomerang-gui/UserProcTableModel.h"
 #include "boomerang-gui/ui_About.h"
 #include "boomerang-gui/ui_MainWindow.h"
 
@@ -19,7 +21,9 @@
 
 #include <QDesktopServices>
 #include <QFileDialog>
+#include <QMenu>
 #include <QSettings>
+#include <QSortFilterProxyModel>
 #include <QTextStream>
 #include <QToolButton>
 
@@ -57,6 +61,9 @@ MainWindow::MainWindow(QWidget *_parent)
     connect(m_decompiler, &Decompiler::procDiscovered, this, &MainWindow::showConsideringProc);
     connect(m_decompiler, &Decompiler::procDecompileStarted, this,
             &MainWindow::showDecompilingProc);
+    connect(m_decompiler, &Decompiler::decodeProgress, this, &MainWindow::showDecodeProgress);
+    connect(m_decompiler, &Decompiler::decompileProgress, this,
+            &MainWindow::showDecompileProgress);
     connect(m_decompiler, &Decompiler::userProcCreated, this, &MainWindow::showNewUserProc);
     connect(m_decompiler, &Decompiler::libProcCreated, this, &MainWindow::showNewLibProc);
     connect(m_decompiler, &Decompiler::userProcRemoved, this, &MainWindow::showRemoveUserProc);
@@ -77,12 +84,46 @@ MainWindow::MainWindow(QWidget *_parent)
             SLOT(addEntryPoint(Address, const QString &)));
     connect(this, SIGNAL(entryPointRemoved(Address)), m_decompiler,
             SLOT(removeEntryPoint(Address)));
+    connect(this, &MainWindow::procDecompileRequested, m_decompiler, &Decompiler::decompileProc);
+    connect(m_decompiler, &Decompiler::procCodeGenerated, this, &MainWindow::showProcCode);
+
+    m_userProcs       = new UserProcTableModel(this);
+    m_userProcsSorted = new QSortFilterProxyModel(this);
+    m_userProcsSorted->setSourceModel(m_userProcs);
+    m_userProcsSorted->setSortRole(UserProcTableModel::SortRole);
+    ui->tblUserProcs->setModel(m_userProcsSorted);
+    ui->tblUserProcs->sortByColumn(UserProcTableModel::ColAddress, Qt::AscendingOrder);
+
+    m_libProcs       = new LibProcTableModel(this);
+    m_libProcsSorted = new QSortFilterProxyModel(this);
+    m_libProcsSorted->setSourceModel(m_libProcs);
+    ui->tblLibProcs->setModel(m_libProcsSorted);
+    ui->tblLibProcs->sortByColumn(LibProcTableModel::ColName, Qt::AscendingOrder);
+
+    connect(m_userProcs, &UserProcTableModel::procRenamed, m_decompiler, &Decompiler::renameProc);
+
+    m_procTableResizeTimer.setSingleShot(true);
+    m_procTableResizeTimer.setInterval(500);
+    connect(&m_procTableResizeTimer, &QTimer::timeout, this, [this]() {
+        ui->tblUserProcs->resizeColumnsToContents();
+        ui->tblLibProcs->resizeColumnsToContents();
+    });
+
+    auto scheduleProcTableResize = [this]() {
+        if (!m_procTableResizeTimer.isActive()) {
+            m_procTableResizeTimer.start();
+        }
+    };
+
+    connect(m_userProcs, &QAbstractItemModel::rowsInserted, this, scheduleProcTableResize);
+    connect(m_libProcs, &QAbstractItemModel::rowsInserted, this, scheduleProcTableResize);
 
     ui->tblUserProcs->horizontalHeader()->disconnect(SIGNAL(sectionClicked(int)));
     connect(ui->tblUserProcs->horizontalHeader(), &QHeaderView::sectionClicked, this,
             &MainWindow::onUserProcsHorizontalHeaderSectionClicked);
 
     ui->tblUserProcs->verticalHeader()->hide();
+    ui->tblUserProcs->setContextMenuPolicy(Qt::CustomContextMenu);
     ui->tblLibProcs->verticalHeader()->hide();
     ui->tblSections->verticalHeader()->hide();
     ui->tblEntryPoints->verticalHeader()->hide();
@@ -314,13 +355,14 @@ void MainWindow::showInitPage()
 
     ui->stackedWidget->setCurrentIndex(0);
     ui->tblEntryPoints->setRowCount(0);
-    ui->tblUserProcs->setRowCount(0);
-    ui->tblLibProcs->setRowCount(0);
+    m_userProcs->clear();
+    m_libProcs->clear();
     ui->twProcTree->clear();
     ui->twModuleTree->clear();
 
     m_numDecompiledProcs = 0;
     m_numCodeGenProcs    = 0;
+    ui->lblUserProcs->setText(tr("User Procedures:"));
 
     ui->actLoad->setEnabled(false);
     ui->actDecode->setEnabled(false);
@@ -356,13 +398,8 @@ void MainWindow::showDecodePage()
 
     ui->stackedWidget->setCurrentIndex(2);
 
-    if (!ui->actDebugEnabled->isChecked()) {
-        ui->tblUserProcs->removeColumn(2);
-    }
-    else {
-        ui->tblUserProcs->setColumnCount(3);
-        ui->tblUserProcs->setHorizontalHeaderItem(2, new QTableWidgetItem(tr("Debug")));
-    }
+    ui->tblUserProcs->setColumnHidden(UserProcTableModel::ColDebug,
+                                      !ui->actDebugEnabled->isChecked());
 
     ui->actDecode->setEnabled(true);
 }
@@ -514,100 +551,50 @@ void MainWindow::showDecompilingProc(const QString &name)
     if (!foundit.isEmpty()) {
         ui->twProcTree->setCurrentItem(foundit.first(), 0);
         foundit.first()->setTextColor(0, QColor("blue"));
-        m_numDecompiledProcs++;
     }
-
-    const int max = ui->tblUserProcs->rowCount();
-    ui->prgDecompile->setRange(0, max);
-    ui->prgDecompile->setValue(m_numDecompiledProcs);
 }
 
 
-void MainWindow::showNewUserProc(const QString &name, Address addr)
+void MainWindow::showDecodeProgress(int numInstructions, int numBytes)
 {
-    const int nrows = ui->tblUserProcs->rowCount();
-
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblUserProcs->item(i, 1)->text() == name) {
-            return;
-        }
-    }
+    ui->lblUserProcs->setText(tr("User Procedures (%1 instructions, %2 bytes decoded):")
+                                  .arg(numInstructions)
+                                  .arg(numBytes));
+}
 
-    const QString s = addr.toString();
 
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblUserProcs->item(i, 0)->text() == s) {
-            return;
-        }
-    }
+void MainWindow::showDecompileProgress(int numProcsDecompiled)
+{
+    m_numDecompiledProcs = numProcsDecompiled;
 
-    ui->tblUserProcs->setRowCount(nrows + 1);
-    ui->tblUserProcs->setItem(nrows, 0, new QTableWidgetItem(addr.toString()));
-    ui->tblUserProcs->setItem(nrows, 1, new QTableWidgetItem(name));
-    ui->tblUserProcs->item(nrows, 1)->setData(1, name);
+    const int max = m_userProcs->rowCount();
+    ui->prgDecompile->setRange(0, qMax(max, m_numDecompiledProcs));
+    ui->prgDecompile->setValue(m_numDecompiledProcs);
+}
 
-    if (ui->actDebugEnabled->isChecked()) {
-        QTableWidgetItem *d = new QTableWidgetItem("");
-        d->setCheckState(Qt::Checked);
-        ui->tblUserProcs->setItem(nrows, 2, d);
-    }
 
-    ui->tblUserProcs->resizeColumnsToContents();
-    ui->tblUserProcs->resizeRowsToContents();
+void MainWindow::showNewUserProc(const QString &name, Address addr)
+{
+    m_userProcs->addProc(name, addr);
 }
 
 
 void MainWindow::showNewLibProc(const QString &name, const QString &params)
 {
-    const int nrows = ui->tblLibProcs->rowCount();
-
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblLibProcs->item(i, 0)->text() == name) {
-            ui->tblLibProcs->item(i, 1)->setText(params);
-            return;
-        }
-    }
-
-    ui->tblLibProcs->setRowCount(nrows + 1);
-    ui->tblLibProcs->setItem(nrows, 0, new QTableWidgetItem(name));
-    ui->tblLibProcs->setItem(nrows, 1, new QTableWidgetItem(params));
-    ui->tblLibProcs->resizeColumnsToContents();
-    ui->tblLibProcs->resizeRowsToContents();
+    m_libProcs->addProc(name, params);
 }
 
 
 void MainWindow::showRemoveUserProc(const QString &name, Address addr)
 {
     Q_UNUSED(name);
-
-    const int nrows          = ui->tblUserProcs->rowCount();
-    const QString addrString = addr.toString();
-
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblUserProcs->item(i, 0)->text() == addrString) {
-            ui->tblUserProcs->removeRow(i);
-            break;
-        }
-    }
-
-    ui->tblUserProcs->resizeColumnsToContents();
-    ui->tblUserProcs->resizeRowsToContents();
+    m_userProcs->removeProc(addr);
 }
 
 
 void MainWindow::showRemoveLibProc(const QString &name)
 {
-    const int nrows = ui->tblLibProcs->rowCount();
-
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblLibProcs->item(i, 0)->text() == name) {
-            ui->tblLibProcs->removeRow(i);
-            break;
-        }
-    }
-
-    ui->tblLibProcs->resizeColumnsToContents();
-    ui->tblLibProcs->resizeRowsToContents();
+    m_libProcs->removeProc(name);
 }
 
 
@@ -649,7 +636,7 @@ void MainWindow::showNewProcInCluster(const QString &name, const QString &module
         m_numCodeGenProcs++;
     }
 
-    ui->prgGenerateCode->setRange(0, ui->tblUserProcs->rowCount());
+    ui->prgGenerateCode->setRange(0, m_userProcs->rowCount());
     ui->prgGenerateCode->setValue(m_numCodeGenProcs);
 }
 
@@ -665,12 +652,9 @@ void MainWindow::showDebuggingPoint(const QString &name, const QString &descript
     statusBar()->showMessage(msg);
     ui->actDebugStep->setEnabled(true);
 
-    for (int i = 0; i < ui->tblUserProcs->rowCount(); i++) {
-        if ((ui->tblUserProcs->item(i, 1)->text() == name) &&
-            (ui->tblUserProcs->item(i, 2)->checkState() != Qt::Checked)) {
-            on_actDebugStep_triggered();
-            return;
-        }
+    if (!m_userProcs->isDebugEnabled(name)) {
+        on_actDebugStep_triggered();
+        return;
     }
 
     showRTLEditor(name);
@@ -700,24 +684,64 @@ void MainWindow::showRTLEditor(const QString &name)
 }
 
 
-void MainWindow::on_tblUserProcs_cellDoubleClicked(int row, int column)
+void MainWindow::showProcCode(const QString &name, const QString &codeFile)
 {
-    Q_UNUSED(column);
-    showRTLEditor(ui->tblUserProcs->item(row, 1)->text());
+    QFile file(codeFile);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return;
+    }
+
+    QTextStream in(&file);
+    const QString contents = in.readAll();
+    file.close();
+
+    const QString tabName = name + ".c";
+    QTextEdit *n          = nullptr;
+
+    for (int i = 0; i < ui->tabWidget->count(); i++) {
+        if (ui->tabWidget->tabText(i) == tabName) {
+            n = dynamic_cast<QTextEdit *>(ui->tabWidget->widget(i));
+            break;
+        }
+    }
+
+    if (n == nullptr) {
+        n = new QTextEdit();
+        n->setReadOnly(true);
+        ui->tabWidget->addTab(n, tabName);
+    }
+
+    n->setPlainText(contents);
+    ui->tabWidget->setCurrentWidget(n);
+}
+
+
+void MainWindow::on_tblUserProcs_doubleClicked(const QModelIndex &index)
+{
+    // double clicking the name edits it instead
+    if (index.column() != UserProcTableModel::ColName) {
+        const int row = m_userProcsSorted->mapToSource(index).row();
+        showRTLEditor(m_userProcs->getProcName(row));
+    }
 }
 
 
-void MainWindow::on_tblUserProcs_cellChanged(int row, int column)
+void MainWindow::on_tblUserProcs_customContextMenuRequested(const QPoint &pos)
 {
-    if (column == 0) {
-        // TODO: should we allow the user to change the address of a proc?
+    const QModelIndex index = ui->tblUserProcs->indexAt(pos);
+    if (!index.isValid()) {
+        return;
     }
 
-    if (column == 1) {
-        const QString oldName = ui->tblUserProcs->item(row, 1)->data(1).toString();
-        const QString newName = ui->tblUserProcs->item(row, 1)->text();
-        m_decompiler->renameProc(oldName, newName);
-        ui->tblUserProcs->item(row, 1)->setData(1, newName);
+    const int row      = m_userProcsSorted->mapToSource(index).row();
+    const QString name = m_userProcs->getProcName(row);
+
+    // Decompile only this procedure; its callees are decompiled afterwards in the background
+    QMenu menu(this);
+    QAction *decompileAction = menu.addAction(tr("Decompile"));
+
+    if (menu.exec(ui->tblUserProcs->viewport()->mapToGlobal(pos)) == decompileAction) {
+        emit procDecompileRequested(name);
     }
 }
 
@@ -807,26 +831,20 @@ void MainWindow::on_actDebugStep_triggered()
 
 void MainWindow::onUserProcsHorizontalHeaderSectionClicked(int logicalIndex)
 {
-    if (logicalIndex == 2) {
-        for (int i = 0; i < ui->tblUserProcs->rowCount(); i++) {
-            if (ui->tblUserProcs->item(i, 2) == nullptr) {
-                ui->tblUserProcs->setItem(i, 2, new QTableWidgetItem(""));
-            }
-
-            Qt::CheckState state = ui->tblUserProcs->item(i, 2)->checkState();
-            ui->tblUserProcs->item(i, 2)->setCheckState(state == Qt::Checked ? Qt::Unchecked
-                                                                             : Qt::Checked);
-        }
+    if (logicalIndex == UserProcTableModel::ColDebug) {
+        m_userProcs->toggleDebugAll();
     }
 }
 
 
-void MainWindow::on_tblLibProcs_cellDoubleClicked(int row, int column)
+void MainWindow::on_tblLibProcs_doubleClicked(const QModelIndex &index)
 {
-    Q_UNUSED(column);
+    const QAbstractItemModel *model = ui->tblLibProcs->model();
+    const int row                   = index.row();
+
     QString name = "";
     QString sigFile;
-    QString params = ui->tblLibProcs->item(row, 1)->text();
+    QString params = model->index(row, LibProcTableModel::ColParams).data().toString();
     bool existing  = true;
 
     if (params == "<unknown>") {
@@ -834,10 +852,10 @@ void MainWindow::on_tblLibProcs_cellDoubleClicked(int row, int column)
 
         // uhh, time to guess?
         for (int i = row; i >= 0; i--) {
-            params = ui->tblLibProcs->item(i, 1)->text();
+            params = model->index(i, LibProcTableModel::ColParams).data().toString();
 
             if (params != "<unknown>") {
-                name = ui->tblLibProcs->item(i, 0)->text();
+                name = model->index(i, LibProcTableModel::ColName).data().toString();
                 break;
             }
         }
@@ -847,7 +865,7 @@ void MainWindow::on_tblLibProcs_cellDoubleClicked(int row, int column)
         }
     }
     else {
-        name = ui->tblLibProcs->item(row, 0)->text();
+        name = model->index(row, LibProcTableModel::ColName).data().toString();
     }
 
     sigFile          = m_decompiler->getSigFilePath(name);
@@ -901,7 +919,7 @@ void MainWindow::on_tblLibProcs_cellDoubleClicked(int row, int column)
         textCursor.movePosition(QTextCursor::End);
         n->setTextCursor(textCursor);
         QString comment = "// unknown library proc: ";
-        comment.append(ui->tblLibProcs->item(row, 0)->text());
+        comment.append(model->index(row, LibProcTableModel::ColName).data().toString());
         comment.append("\n");
         n->insertPlainText(comment);
     }
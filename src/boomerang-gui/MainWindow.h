@@ -13,16 +13,21 @@
 
 #include <QMainWindow>
 #include <QThread>
+#include <QTimer>
 
 #include <map>
 #include <set>
 #include <vector>
 
 
+class QModelIndex;
+class QSortFilterProxyModel;
 class QToolButton;
 class QTreeWidgetItem;
 class QTableWidgetItem;
 class Decompiler;
+class LibProcTableModel;
+class UserProcTableModel;
 
 
 namespace Ui
@@ -45,6 +50,7 @@ signals:
     void librarySignaturesOutdated();
     void entryPointAdded(Address entryAddr, const QString &name);
     void entryPointRemoved(Address entryAddr);
+    void procDecompileRequested(const QString &name);
 
 public slots:
     void loadComplete();
@@ -61,6 +67,8 @@ public slots:
     void on_cbOutputPath_currentIndexChanged(const QString &text);
     void showConsideringProc(const QString &parent, const QString &name);
     void showDecompilingProc(const QString &name);
+    void showDecodeProgress(int numInstructions, int numBytes);
+    void showDecompileProgress(int numProcsDecompiled);
     void showNewUserProc(const QString &name, Address addr);
     void showNewLibProc(const QString &name, const QString &params);
     void showRemoveUserProc(const QString &name, Address addr);
@@ -72,15 +80,16 @@ public slots:
     void showDebuggingPoint(const QString &name, const QString &description);
     void showNewSection(const QString &name, Address start, Address end);
     void showRTLEditor(const QString &name);
+    void showProcCode(const QString &name, const QString &codeFile);
 
     void on_twModuleTree_itemDoubleClicked(QTreeWidgetItem *item, int column);
     void on_twProcTree_itemDoubleClicked(QTreeWidgetItem *item, int column);
     void on_actDebugEnabled_toggled(bool b);
     void on_actDebugStep_triggered();
     void onUserProcsHorizontalHeaderSectionClicked(int logicalIndex);
-    void on_tblUserProcs_cellDoubleClicked(int row, int column);
-    void on_tblUserProcs_cellChanged(int row, int column);
-    void on_tblLibProcs_cellDoubleClicked(int row, int column);
+    void on_tblUserProcs_doubleClicked(const QModelIndex &index);
+    void on_tblUserProcs_customContextMenuRequested(const QPoint &pos);
+    void on_tblLibProcs_doubleClicked(const QModelIndex &index);
     void on_actNewProject_triggered();
     void on_actSaveProject_triggered();
     void on_actCloseProject_triggered();
@@ -136,4 +145,12 @@ private:
 
     QToolButton *m_debugStep = nullptr;
     QWidget *m_structsView   = nullptr;
+
+    UserProcTableModel *m_userProcs          = nullptr;
+    LibProcTableModel *m_libProcs            = nullptr;
+    QSortFilterProxyModel *m_userProcsSorted = nullptr;
+    QSortFilterProxyModel *m_libProcsSorted  = nullptr;
+
+    /// Resizing the proc tables is expensive, so only do it once after a batch of changes
+    QTimer m_procTableResizeTimer;
 };
@@ -0,0 +1,245 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "UserProcTableModel.h"
+
+
+UserProcTableModel::UserProcTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+    , m_flushTimer(this)
+{
+    // Coalesce all procs created within a short time into a single insertion
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(100);
+    connect(&m_flushTimer, &QTimer::timeout, this, &UserProcTableModel::flushPendingProcs);
+}
+
+
+int UserProcTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(m_rows.size());
+}
+
+
+int UserProcTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : NumColumns;
+}
+
+
+QVariant UserProcTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= static_cast<int>(m_rows.size())) {
+        return QVariant();
+    }
+
+    const ProcRow &row = m_rows[index.row()];
+
+    switch (index.column()) {
+    case ColAddress:
+        if (role == Qt::DisplayRole) {
+            return row.addr.toString();
+        }
+        else if (role == SortRole) {
+            return QVariant::fromValue<qulonglong>(row.addr.value());
+        }
+        break;
+
+    case ColName:
+        if (role == Qt::DisplayRole || role == Qt::EditRole || role == SortRole) {
+            return row.name;
+        }
+        break;
+
+    case ColDebug:
+        if (role == Qt::CheckStateRole) {
+            return row.debug ? Qt::Checked : Qt::Unchecked;
+        }
+        else if (role == SortRole) {
+            return row.debug;
+        }
+        break;
+    }
+
+    return QVariant();
+}
+
+
+bool UserProcTableModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (!index.isValid() || index.row() >= static_cast<int>(m_rows.size())) {
+        return false;
+    }
+
+    ProcRow &row = m_rows[index.row()];
+
+    if (index.column() == ColName && role == Qt::EditRole) {
+        const QString newName = value.toString();
+        if (newName.isEmpty() || m_rowByName.contains(newName)) {
+            return false;
+        }
+
+        const QString oldName = row.name;
+        m_rowByName.remove(oldName);
+        m_rowByName.insert(newName, index.row());
+        row.name = newName;
+
+        emit dataChanged(index, index);
+        emit procRenamed(oldName, newName);
+        return true;
+    }
+    else if (index.column() == ColDebug && role == Qt::CheckStateRole) {
+        row.debug = value.toInt() == Qt::Checked;
+        emit dataChanged(index, index);
+        return true;
+    }
+
+    return false;
+}
+
+
+QVariant UserProcTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    switch (section) {
+    case ColAddress: return tr("Address");
+    case ColName: return tr("Name");
+    case ColDebug: return tr("Debug");
+    }
+
+    return QVariant();
+}
+
+
+Qt::ItemFlags UserProcTableModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid()) {
+        return Qt::NoItemFlags;
+    }
+
+    switch (index.column()) {
+    case ColName: return Qt::ItemIsSelectable | Qt::ItemIsEnabled | Qt::ItemIsEditable;
+    case ColDebug: return Qt::ItemIsSelectable | Qt::ItemIsEnabled | Qt::ItemIsUserCheckable;
+    default: return Qt::ItemIsSelectable | Qt::ItemIsEnabled;
+    }
+}
+
+
+void UserProcTableModel::addProc(const QString &name, Address entryAddr)
+{
+    if (m_rowByName.contains(name) || m_rowByAddr.find(entryAddr.value()) != m_rowByAddr.end()) {
+        return;
+    }
+
+    const int row = static_cast<int>(m_rows.size() + m_pendingRows.size());
+    m_rowByName.insert(name, row);
+    m_rowByAddr[entryAddr.value()] = row;
+    m_pendingRows.push_back({ entryAddr, name, true });
+
+    if (!m_flushTimer.isActive()) {
+        m_flushTimer.start();
+    }
+}
+
+
+void UserProcTableModel::removeProc(Address entryAddr)
+{
+    flushPendingProcs();
+
+    auto it = m_rowByAddr.find(entryAddr.value());
+    if (it == m_rowByAddr.end()) {
+        return;
+    }
+
+    const int row = it->second;
+
+    beginRemoveRows(QModelIndex(), row, row);
+    m_rowByName.remove(m_rows[row].name);
+    m_rowByAddr.erase(it);
+    m_rows.erase(m_rows.begin() + row);
+    rebuildIndex(row);
+    endRemoveRows();
+}
+
+
+void UserProcTableModel::clear()
+{
+    m_flushTimer.stop();
+
+    beginResetModel();
+    m_rows.clear();
+    m_pendingRows.clear();
+    m_rowByName.clear();
+    m_rowByAddr.clear();
+    endResetModel();
+}
+
+
+QString UserProcTableModel::getProcName(int row) const
+{
+    return (row >= 0 && row < static_cast<int>(m_rows.size())) ? m_rows[row].name : QString();
+}
+
+
+bool UserProcTableModel::isDebugEnabled(const QString &name) const
+{
+    const int row = m_rowByName.value(name, -1);
+    if (row < 0) {
+        return true;
+    }
+
+    return row < static_cast<int>(m_rows.size()) ? m_rows[row].debug
+                                                 : m_pendingRows[row - m_rows.size()].debug;
+}
+
+
+void UserProcTableModel::toggleDebugAll()
+{
+    flushPendingProcs();
+
+    if (m_rows.empty()) {
+        return;
+    }
+
+    for (ProcRow &row : m_rows) {
+        row.debug = !row.debug;
+    }
+
+    emit dataChanged(index(0, ColDebug), index(static_cast<int>(m_rows.size()) - 1, ColDebug));
+}
+
+
+void UserProcTableModel::flushPendingProcs()
+{
+    m_flushTimer.stop();
+
+    if (m_pendingRows.empty()) {
+        return;
+    }
+
+    const int first = static_cast<int>(m_rows.size());
+    const int last  = first + static_cast<int>(m_pendingRows.size()) - 1;
+
+    beginInsertRows(QModelIndex(), first, last);
+    m_rows.insert(m_rows.end(), m_pendingRows.begin(), m_pendingRows.end());
+    m_pendingRows.clear();
+    endInsertRows();
+}
+
+
+void UserProcTableModel::rebuildIndex(int firstRow)
+{
+    for (int i = firstRow; i < static_cast<int>(m_rows.size()); i++) {
+        m_rowByName[m_rows[i].name]        = i;
+        m_rowByAddr[m_rows[i].addr.value()] = i;
+    }
+}
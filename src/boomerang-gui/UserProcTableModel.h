@@ -0,0 +1,122 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/util/Address.h"
+
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QTimer>
+
+#include <unordered_map>
+#include <vector>
+
+
+/**
+ * Table model of all user procedures of the program (address, name, debug flag).
+ *
+ * The decompiler may create tens of thousands of procedures in quick succession,
+ * so new procedures are not inserted immediately, but collected and inserted
+ * together after a short delay.
+ * Lookups by name and address are done via hash indexes.
+ */
+class UserProcTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        ColAddress = 0,
+        ColName    = 1,
+        ColDebug   = 2,
+        NumColumns
+    };
+
+    /// Role returning a value suitable for sorting the column
+    static constexpr int SortRole = Qt::UserRole;
+
+public:
+    explicit UserProcTableModel(QObject *parent = nullptr);
+    UserProcTableModel(const UserProcTableModel &other) = delete;
+    UserProcTableModel(UserProcTableModel &&other)      = delete;
+
+    ~UserProcTableModel() override = default;
+
+    UserProcTableModel &operator=(const UserProcTableModel &other) = delete;
+    UserProcTableModel &operator=(UserProcTableModel &&other) = delete;
+
+public:
+    /// \copydoc QAbstractTableModel::rowCount
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractTableModel::columnCount
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractTableModel::data
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /// \copydoc QAbstractTableModel::setData
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+
+    /// \copydoc QAbstractTableModel::headerData
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+    /// \copydoc QAbstractTableModel::flags
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+public:
+    /// Add a new procedure. Procedures with an existing name or address are ignored.
+    void addProc(const QString &name, Address entryAddr);
+
+    /// Remove the procedure starting at \p entryAddr.
+    void removeProc(Address entryAddr);
+
+    /// Remove all procedures.
+    void clear();
+
+    /// \returns the name of the procedure in row \p row.
+    QString getProcName(int row) const;
+
+    /// \returns false iff the user disabled stopping at debug points of the procedure \p name.
+    bool isDebugEnabled(const QString &name) const;
+
+    /// Toggle the debug flag of all procedures.
+    void toggleDebugAll();
+
+    /// Insert all procedures that have been added but are not yet part of the model.
+    void flushPendingProcs();
+
+signals:
+    /// Emitted when the user renamed a procedure.
+    void procRenamed(const QString &oldName, const QString &newName);
+
+private:
+    struct ProcRow
+    {
+        Address addr;
+        QString name;
+        bool debug;
+    };
+
+    void rebuildIndex(int firstRow);
+
+private:
+    std::vector<ProcRow> m_rows;
+    std::vector<ProcRow> m_pendingRows; ///< Procs added, but not yet inserted into the model
+
+    /// Indexes into m_rows and m_pendingRows (offset by m_rows.size())
+    QHash<QString, int> m_rowByName;
+    std::unordered_map<Address::value_type, int> m_rowByAddr;
+
+    QTimer m_flushTimer;
+};
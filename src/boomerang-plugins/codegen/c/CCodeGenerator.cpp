@@ -33,8 +33,14 @@
 #include "boomerang/ssl/type/FuncType.h"
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/PointerType.h"
+#include "boomerang/util/OStream.h"
 #include "boomerang/util/log/Log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
 
 bool isBareMemof(const Exp &exp, UserProc *)
 {
@@ -69,6 +75,11 @@ void CCodeGenerator::generateCode(const Prog *prog, Module *cluster, UserProc *p
     const bool generate_all = cluster == nullptr || cluster == prog->getRootModule();
     bool all_procedures     = (proc == nullptr);
 
+    // Start with fresh output files, so code generated for a single module or procedure
+    // is not appended to the code generated before. This also makes sure we do not write to
+    // files of a previously loaded program whose modules were destroyed.
+    m_writer.clear();
+
     if (generate_all) {
         if (proc == nullptr) {
             bool global = false;
@@ -104,6 +115,10 @@ void CCodeGenerator::generateCode(const Prog *prog, Module *cluster, UserProc *p
         print(prog->getRootModule());
     }
 
+    // After cancelling decompilation, only generate code for completely decompiled procs.
+    const bool partialResults = prog->getProject()->getCancellationToken().isCancelled();
+    std::vector<std::pair<const Module *, UserProc *>> procsToGenerate;
+
     for (const auto &module : prog->getModuleList()) {
         if (!generate_all && (module.get() != cluster)) {
             continue;
@@ -119,13 +134,75 @@ void CCodeGenerator::generateCode(const Prog *prog, Module *cluster, UserProc *p
             if (!_proc->isDecoded()) {
                 continue;
             }
+            else if (partialResults && !_proc->isDecompiled()) {
+                continue; // decompilation of this proc was cancelled
+            }
 
             if (!all_procedures && (proc != _proc)) {
                 continue;
             }
 
-            generateCode(_proc);
-            print(module.get());
+            procsToGenerate.emplace_back(module.get(), _proc);
+        }
+    }
+
+    m_lines.clear();
+    generateProcCode(procsToGenerate);
+    m_writer.flush();
+}
+
+
+void CCodeGenerator::generateProcCode(
+    const std::vector<std::pair<const Module *, UserProc *>> &procs)
+{
+    const std::size_t numThreads = std::max(1U, std::thread::hardware_concurrency());
+
+    // Only the code of a few procedures per thread is kept in memory at any time.
+    const std::size_t chunkSize = 4 * numThreads;
+
+    for (std::size_t chunkStart = 0; chunkStart < procs.size(); chunkStart += chunkSize) {
+        const std::size_t chunkEnd = std::min(procs.size(), chunkStart + chunkSize);
+
+        // Everything that modifies the procedures or might notify watchers
+        // (and therefore stop at debug points) is done sequentially on the calling thread.
+        std::vector<std::unique_ptr<CCodeGenerator>> generators;
+        std::vector<CCodeGenerator *> bodiesToGenerate;
+
+        for (std::size_t i = chunkStart; i < chunkEnd; i++) {
+            generators.emplace_back(new CCodeGenerator(nullptr));
+
+            if (generators.back()->beginProc(procs[i].second)) {
+                bodiesToGenerate.push_back(generators.back().get());
+            }
+        }
+
+        // Generate the bodies concurrently, each into the buffer of its own code generator.
+        std::atomic<std::size_t> nextBody(0);
+        auto generateBodies = [&bodiesToGenerate, &nextBody]() {
+            for (std::size_t i = nextBody++; i < bodiesToGenerate.size(); i = nextBody++) {
+                bodiesToGenerate[i]->generateProcBody();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < std::min(numThreads, bodiesToGenerate.size()); i++) {
+            workers.emplace_back(generateBodies);
+        }
+
+        generateBodies();
+
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+
+        // Write the code in the original order, so the output does not depend on scheduling.
+        for (std::size_t i = chunkStart; i < chunkEnd; i++) {
+            UserProc *proc = procs[i].second;
+            m_writer.writeCode(procs[i].first, generators[i - chunkStart]->m_lines);
+
+            if (proc->getCFG() && proc->getEntryBB()) {
+                proc->setStatus(ProcStatus::CodegenDone);
+            }
         }
     }
 }
@@ -170,7 +247,7 @@ void CCodeGenerator::addAssignmentStatement(const Assign *asgn)
     else if ((lhs->getOper() == opAt) && lhs->getSubExp2()->isIntConst() &&
              lhs->getSubExp3()->isIntConst()) {
         // exp1@[n:m] := rhs -> exp1 = exp1 & mask | rhs << m  where mask = ~((1 << m-n+1)-1)
-        SharedExp exp1 = lhs->getSubExp1();
+        SharedExp exp1 = lhs->getSubExp1()->clone();
         int n          = lhs->access<Const, 2>()->getInt();
         int m          = lhs->access<Const, 3>()->getInt();
         appendExp(ost, *exp1, OpPrec::Assign);
@@ -184,7 +261,7 @@ void CCodeGenerator::addAssignmentStatement(const Assign *asgn)
                           exp1,
                           Binary::get(opBitOr,
                                       Const::get(mask),
-                                      Binary::get(opShL, rhs, Const::get(m))));
+                                      Binary::get(opShL, rhs->clone(), Const::get(m))));
         // clang-format on
         rhs = rhs->simplify();
 
@@ -427,16 +504,15 @@ void CCodeGenerator::addPrototype(UserProc *proc)
 }
 
 
-void CCodeGenerator::generateCode(UserProc *proc)
+bool CCodeGenerator::beginProc(UserProc *proc)
 {
     m_lines.clear();
     m_proc = proc;
 
     if (!proc->getCFG() || !proc->getEntryBB()) {
-        return;
+        return false;
     }
 
-    m_analyzer.structureCFG(proc->getCFG());
     PassManager::get()->executePass(PassID::UnusedLocalRemoval, proc);
 
     // Note: don't try to remove unused statements here; that requires the
@@ -447,8 +523,21 @@ void CCodeGenerator::generateCode(UserProc *proc)
     }
 
     // Start generating code for this procedure.
+    // Adding the signature may replace parameters in the statements of the procedure.
     this->addProcStart(proc);
 
+    // The statements are collected lazily, so collect them now
+    // while no other thread generates code.
+    proc->getCFG()->getStatements();
+    return true;
+}
+
+
+void CCodeGenerator::generateProcBody()
+{
+    UserProc *proc = m_proc;
+    m_analyzer.structureCFG(proc->getCFG());
+
     // Local variables; print everything in the locals map
     std::map<QString, SharedType>::const_iterator last = proc->getLocals().end();
 
@@ -475,8 +564,6 @@ void CCodeGenerator::generateCode(UserProc *proc)
     if (m_proc->getProg()->getProject()->getSettings()->removeLabels) {
         removeUnusedLabels();
     }
-
-    proc->setStatus(ProcStatus::CodegenDone);
 }
 
 
@@ -847,7 +934,7 @@ void CCodeGenerator::addGoto(const BasicBlock *bb)
     OStream s(&tgt);
 
     indent(s, m_indent);
-    s << "goto bb0x" << QString::number(bb->getLowAddr().value(), 16) << ";";
+    s << "goto bb0x" << HexNumber(bb->getLowAddr().value()) << ";";
     appendLine(tgt);
     m_usedLabels.insert(bb->getLowAddr().value());
 }
@@ -880,7 +967,7 @@ void CCodeGenerator::addLabel(const BasicBlock *bb)
     QString tgt;
     OStream s(&tgt);
 
-    s << "bb0x" << QString::number(bb->getLowAddr().value(), 16) << ":";
+    s << "bb0x" << HexNumber(bb->getLowAddr().value()) << ":";
     appendLine(tgt);
 }
 
@@ -1026,7 +1113,7 @@ void CCodeGenerator::appendExp(OStream &str, const Exp &exp, OpPrec curPrec, boo
             }
             else {
                 // Output it in 0xF0000000 style
-                str << "0x" << QString::number(uint32_t(K), 16);
+                str << "0x" << HexNumber(uint32_t(K));
             }
         }
         else {
@@ -1052,7 +1139,7 @@ void CCodeGenerator::appendExp(OStream &str, const Exp &exp, OpPrec curPrec, boo
                     str << K; // Just a plain vanilla int
                 }
                 else {
-                    str << "0x" << QString::number(uint32_t(K), 16); // 0x2000 style
+                    str << "0x" << HexNumber(uint32_t(K)); // 0x2000 style
                 }
             }
         }
@@ -1064,7 +1151,7 @@ void CCodeGenerator::appendExp(OStream &str, const Exp &exp, OpPrec curPrec, boo
         // str << std::dec << c->getLong() << "LL"; break;
         if ((static_cast<long long>(constExp.getLong()) < -1000LL) ||
             (constExp.getLong() > 1000ULL)) {
-            str << "0x" << QString::number(constExp.getLong(), 16) << "LL";
+            str << "0x" << HexNumber(constExp.getLong()) << "LL";
         }
         else {
             str << constExp.getLong() << "LL";
@@ -1284,7 +1371,7 @@ void CCodeGenerator::appendExp(OStream &str, const Exp &exp, OpPrec curPrec, boo
             str << mask;
         }
         else {
-            str << "0x" << QString::number(mask, 16);
+            str << "0x" << HexNumber(mask);
         }
 
         closeParen(str, curPrec, OpPrec::BitAnd);
@@ -2049,7 +2136,7 @@ void CCodeGenerator::generateCode_Loop(const BasicBlock *bb, std::list<const Bas
         SharedExp cond = bb->getCond();
 
         if (bb->getSuccessor(BTHEN) == m_analyzer.getLoopFollow(bb)) {
-            cond = Unary::get(opLNot, cond)->simplify();
+            cond = Unary::get(opLNot, cond->clone())->simplify();
         }
 
         addPretestedLoopHeader(cond);
@@ -2113,10 +2200,10 @@ void CCodeGenerator::generateCode_Loop(const BasicBlock *bb, std::list<const Bas
 
             SharedExp cond = myLatch->getCond();
             if (myLatch->getSuccessor(BELSE) == myHead) {
-                addPostTestedLoopEnd(Unary::get(opLNot, cond)->simplify());
+                addPostTestedLoopEnd(Unary::get(opLNot, cond->clone())->simplify());
             }
             else {
-                addPostTestedLoopEnd(cond->simplify());
+                addPostTestedLoopEnd(cond->clone()->simplify());
             }
         }
         else {
@@ -23,6 +23,8 @@
 #include <list>
 #include <map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 
 class BasicBlock;
@@ -135,8 +137,27 @@ private:
     /// Add a prototype (for forward declaration)
     void addPrototype(UserProc *proc);
 
-    /// Generate code for a single procedure.
-    void generateCode(UserProc *proc);
+    /**
+     * Generate code for all procedures in \p procs and write it to the output file
+     * of the respective module, in the order of \p procs.
+     * The procedures are prepared one after another by beginProc,
+     * then their bodies are generated concurrently by generateProcBody.
+     */
+    void generateProcCode(const std::vector<std::pair<const Module *, UserProc *>> &procs);
+
+    /**
+     * Start generating code for \p proc: Remove unused locals and add the signature.
+     * This modifies \p proc and may notify watchers, so it must not run concurrently.
+     * \returns false if \p proc has no code to generate.
+     */
+    bool beginProc(UserProc *proc);
+
+    /**
+     * Generate the locals and the body of the procedure started by beginProc.
+     * Only reads the Prog and the procedure, so it is safe to call concurrently
+     * on different code generators for different procedures.
+     */
+    void generateProcBody();
 
     /// Generate global variables from data sections.
     void generateDataSectionCode(const BinaryImage *image, QString sectionName,
@@ -57,6 +57,26 @@ bool CodeWriter::writeCode(const Module *module, const QStringList &lines)
     }
 
     assert(it != m_dests.end());
-    it->second.m_os << lines.join('\n') << '\n';
+
+    // Write line by line instead of joining all lines first,
+    // which would create another copy of the code.
+    for (const QString &line : lines) {
+        it->second.m_os << line << '\n';
+    }
+
     return true;
 }
+
+
+void CodeWriter::flush()
+{
+    for (auto &dest : m_dests) {
+        dest.second.m_os.flush();
+    }
+}
+
+
+void CodeWriter::clear()
+{
+    m_dests.clear();
+}
@@ -53,6 +53,12 @@ public:
 public:
     bool writeCode(const Module *module, const QStringList &lines);
 
+    /// Flush all open output files.
+    void flush();
+
+    /// Close all open output files.
+    void clear();
+
 private:
     WriteDestMap m_dests;
 };
@@ -158,6 +158,10 @@ bool PentiumFrontEnd::initialize(Project *project)
     }
 
     m_decoder = plugin->getIfc<IDecoder>();
+
+    m_overlappedRegsProcessed.clear();
+    m_floatProcessed.clear();
+
     return DefaultFrontEnd::initialize(project);
 }
 
@@ -22,6 +22,8 @@
 #include <QBuffer>
 #include <QFile>
 
+#include <algorithm>
+
 
 struct SectionParam
 {
@@ -53,6 +55,23 @@ struct Translated_ElfSym
 typedef std::map<QString, int, std::less<QString>> StrIntMap;
 
 
+/**
+ * Read a table of \p count ELF structures at \p src and convert all of them
+ * to host endianness at once.
+ * \note All members of \a Entry must be 32 bits wide.
+ */
+template<typename Entry>
+static std::vector<Entry> readTable(const void *src, std::size_t count, Endian srcEndian)
+{
+    static_assert(sizeof(Entry) % sizeof(DWord) == 0, "Entry must consist of 32 bit words");
+
+    std::vector<Entry> table(count);
+    Util::readDWords(reinterpret_cast<DWord *>(table.data()), src,
+                     count * sizeof(Entry) / sizeof(DWord), srcEndian);
+    return table;
+}
+
+
 ElfBinaryLoader::ElfBinaryLoader(Project *project)
     : IFileLoader(project)
     , m_nextExtern(Address::ZERO)
@@ -95,6 +114,9 @@ void ElfBinaryLoader::init()
     m_lastSize      = 0;
     m_importStubs   = nullptr;
     m_elfSections.clear();
+    m_relocationSites.clear();
+    m_relocations.clear();
+    m_relocationsIndexed = false;
 }
 
 
@@ -168,6 +190,10 @@ bool ElfBinaryLoader::loadFromMemory(QByteArray &img)
     m_shLink = new Elf32_Word[numSections];
     m_shInfo = new Elf32_Word[numSections];
 
+    // Convert all section headers at once instead of reading each field separately
+    const std::vector<Elf32_Shdr> sectionHdrs = readTable<Elf32_Shdr>(m_sectionHdrs, numSections,
+                                                                      m_endian);
+
     // Set up section header string table pointer
     const Elf32_Half stringSectionIndex = elfRead2(&m_elfHeader->e_shstrndx);
 
@@ -176,7 +202,7 @@ bool ElfBinaryLoader::loadFromMemory(QByteArray &img)
         return false;
     }
 
-    const Elf32_Off stringSectionOffset = elfRead4(&m_sectionHdrs[stringSectionIndex].sh_offset);
+    const Elf32_Off stringSectionOffset = sectionHdrs[stringSectionIndex].sh_offset;
     if (!Util::inRange(stringSectionOffset, 1UL, m_loadedImageSize)) {
         LOG_ERROR("Cannot load ELF file: Invalid string section offset %1", stringSectionOffset);
     }
@@ -188,17 +214,8 @@ bool ElfBinaryLoader::loadFromMemory(QByteArray &img)
 
     for (Elf32_Half i = 0; i < numSections; i++) {
         // Get section information.
-        const Elf32_Shdr *sectionHeader = m_sectionHdrs + i;
-
-        // Check if this section header entry is fully contained in this file
-        if (reinterpret_cast<const Byte *>(sectionHeader + 1) > m_loadedImage + m_loadedImageSize) {
-            LOG_ERROR(
-                "Cannot load ELF file: Section header for section %1 extends past image boundary",
-                i);
-            return false;
-        }
-
-        const char *sectionName = m_strings + elfRead4(&sectionHeader->sh_name);
+        const Elf32_Shdr *sectionHeader = &sectionHdrs[i];
+        const char *sectionName         = m_strings + sectionHeader->sh_name;
 
         if (reinterpret_cast<const Byte *>(sectionName) > m_loadedImage + m_loadedImageSize) {
             LOG_ERROR("Cannot load ELF file: Section name for section %1 is outside of image size",
@@ -215,7 +232,7 @@ bool ElfBinaryLoader::loadFromMemory(QByteArray &img)
         newSection.Data     = false;
         newSection.ReadOnly = false;
 
-        Elf32_Off _off = elfRead4(&sectionHeader->sh_offset);
+        Elf32_Off _off = sectionHeader->sh_offset;
         if (!Util::inRange(_off, 0UL, m_loadedImageSize)) {
             LOG_ERROR("Cannot load ELF file: Section data for section %1 is outside of image size",
                       i);
@@ -225,8 +242,8 @@ bool ElfBinaryLoader::loadFromMemory(QByteArray &img)
             newSection.imagePtr = HostAddress(m_loadedImage) + _off;
         }
 
-        newSection.SourceAddr = Address(elfRead4(&sectionHeader->sh_addr));
-        newSection.Size       = elfRead4(&sectionHeader->sh_size);
+        newSection.SourceAddr = Address(sectionHeader->sh_addr);
+        newSection.Size       = sectionHeader->sh_size;
 
         if (_off + newSection.Size > m_loadedImageSize && !newSection.Bss) {
             LOG_ERROR("Cannot load ELF file: Section %1 extends past image boundary", i);
@@ -234,7 +251,7 @@ bool ElfBinaryLoader::loadFromMemory(QByteArray &img)
         }
 
         if (newSection.SourceAddr.isZero() && !QString(sectionName).startsWith(".rel")) {
-            const Elf32_Word align = elfRead4(&sectionHeader->sh_addralign);
+            const Elf32_Word align = sectionHeader->sh_addralign;
 
             if (align > 1) {
                 if (arbitaryLoadAddr.value() % align != 0) {
@@ -246,20 +263,20 @@ bool ElfBinaryLoader::loadFromMemory(QByteArray &img)
             arbitaryLoadAddr += newSection.Size ? newSection.Size : 1;
         }
 
-        newSection.sectionType = elfRead4(&sectionHeader->sh_type);
-        newSection.entry_size  = elfRead4(&sectionHeader->sh_entsize);
-        m_shLink[i]            = elfRead4(&sectionHeader->sh_link);
-        m_shInfo[i]            = elfRead4(&sectionHeader->sh_info);
+        newSection.sectionType = sectionHeader->sh_type;
+        newSection.entry_size  = sectionHeader->sh_entsize;
+        m_shLink[i]            = sectionHeader->sh_link;
+        m_shInfo[i]            = sectionHeader->sh_info;
 
         if (newSection.SourceAddr + newSection.Size > m_nextExtern) {
             m_firstExtern = m_nextExtern = newSection.SourceAddr + newSection.Size;
         }
 
-        if ((elfRead4(&sectionHeader->sh_flags) & SHF_WRITE) == 0) {
+        if ((sectionHeader->sh_flags & SHF_WRITE) == 0) {
             newSection.ReadOnly = true;
         }
 
-        if (elfRead4(&sectionHeader->sh_flags) & SHF_EXECINSTR) {
+        if (sectionHeader->sh_flags & SHF_EXECINSTR) {
             newSection.Code = true;
             seenCode        = true; // We've got to a code section
         }
@@ -277,8 +294,8 @@ bool ElfBinaryLoader::loadFromMemory(QByteArray &img)
         // NOTE: this ASSUMES that sections appear in a sensible order in the input binary file:
         // junk, code, rodata, data, bss
         if (seenCode &&
-            ((elfRead4(&sectionHeader->sh_flags) & (SHF_EXECINSTR | SHF_ALLOC)) == SHF_ALLOC) &&
-            (elfRead4(&sectionHeader->sh_type) != SHT_NOBITS)) {
+            ((sectionHeader->sh_flags & (SHF_EXECINSTR | SHF_ALLOC)) == SHF_ALLOC) &&
+            (sectionHeader->sh_type != SHT_NOBITS)) {
             newSection.Data = true;
         }
 
@@ -578,6 +595,8 @@ void ElfBinaryLoader::addSymbolsForSection(int secIndex)
     const int numSymbols = section.Size / section.entry_size;
     QString fileName;
 
+    m_symbols->reserve(numSymbols);
+
     // Index 0 is a dummy entry
     for (int i = 1; i < numSymbols; i++) {
         Translated_ElfSym translatedSym;
@@ -849,14 +868,18 @@ void ElfBinaryLoader::applyRelocations()
     const Elf32_Half machine = elfRead2(&m_elfHeader->e_machine);
     const Elf32_Half e_type  = elfRead2(&m_elfHeader->e_type);
 
+    m_relocationSites.clear();
+    m_relocations.clear();
+    m_relocationsIndexed = false;
+
     for (size_t i = 1; i < m_elfSections.size(); ++i) {
         const SectionParam &ps(m_elfSections[i]);
         if (ps.sectionType == SHT_RELA) {
-            const Elf32_Rela *relaEntries = reinterpret_cast<const Elf32_Rela *>(
+            const Elf32_Rela *rawEntries = reinterpret_cast<const Elf32_Rela *>(
                 ps.imagePtr.value());
             const DWord numEntries = ps.Size / sizeof(Elf32_Rela);
 
-            if (relaEntries == nullptr) {
+            if (rawEntries == nullptr) {
                 LOG_WARN("Cannot read relocation entries from invalid section %1", i);
                 continue;
             }
@@ -867,13 +890,33 @@ void ElfBinaryLoader::applyRelocations()
                 continue;
             }
 
+            // NOTE: the r_offset is different for .o files (E_REL in the e_type header field)
+            // than for exe's and shared objects!
+            Address destNatOrigin = Address::ZERO;
+
+            if (e_type == ET_REL) {
+                const Elf32_Word destSection = m_shInfo[i];
+                if (!Util::inRange(destSection, 0UL, m_elfSections.size())) {
+                    continue;
+                }
+
+                destNatOrigin = m_elfSections[destSection].SourceAddr;
+            }
+
+            const std::vector<Elf32_Rela> relaEntries = readTable<Elf32_Rela>(
+                rawEntries, numEntries, m_endian);
+
+            for (DWord u = 0; u < numEntries; u++) {
+                const DWord r_info = relaEntries[u].r_info;
+                addRelocationSite(destNatOrigin + relaEntries[u].r_offset, ELF32_R_TYPE(r_info),
+                                  m_shLink[i], ELF32_R_SYM(r_info));
+            }
+
             switch (machine) {
             case EM_SPARC:
-                // NOTE: the r_offset is different for .o files (E_REL in the e_type header field)
-                // than for exe's and shared objects!
                 for (DWord u = 0; u < numEntries; u++) {
-                    Elf32_Byte relType = ELF32_R_TYPE(elfRead4(&relaEntries[u].r_info));
-                    // Elf32_Word symTabIndex = ELF32_R_SYM(elfRead4(&relaEntries[u].r_info));
+                    Elf32_Byte relType = ELF32_R_TYPE(relaEntries[u].r_info);
+                    // Elf32_Word symTabIndex = ELF32_R_SYM(relaEntries[u].r_info);
 
                     switch (relType) {
                     case R_SPARC_NONE: // just ignore (common)
@@ -934,18 +977,25 @@ void ElfBinaryLoader::applyRelocations()
                                                       m_elfSections[symSectionIdx].imagePtr.value())
                                                 : nullptr;
 
-            const Elf32_Rel *relEntries = reinterpret_cast<const Elf32_Rel *>(ps.imagePtr.value());
+            const Elf32_Rel *rawEntries = reinterpret_cast<const Elf32_Rel *>(ps.imagePtr.value());
             const DWord numEntries      = ps.Size / sizeof(Elf32_Rel);
-            if (ps.Size % sizeof(Elf32_Rel) != 0) {
+            if (rawEntries == nullptr) {
+                LOG_WARN("Cannot read relocation entries from invalid section %1", i);
+                continue;
+            }
+            else if (ps.Size % sizeof(Elf32_Rel) != 0) {
                 LOG_WARN("Invalid size %1 of relocation section %2 (must be divisible by %3)",
                          ps.Size, i, sizeof(Elf32_Rel));
                 continue;
             }
 
+            const std::vector<Elf32_Rel> relEntries = readTable<Elf32_Rel>(rawEntries, numEntries,
+                                                                           m_endian);
+
             for (unsigned u = 0; u < numEntries; u++) {
-                const Elf32_Addr r_offset  = elfRead4(&relEntries[u].r_offset);
-                const Elf32_Byte relType   = ELF32_R_TYPE(elfRead4(&relEntries[u].r_info));
-                const Elf32_Word symbolIdx = ELF32_R_SYM(elfRead4(&relEntries[u].r_info));
+                const Elf32_Addr r_offset  = relEntries[u].r_offset;
+                const Elf32_Byte relType   = ELF32_R_TYPE(relEntries[u].r_info);
+                const Elf32_Word symbolIdx = ELF32_R_SYM(relEntries[u].r_info);
 
                 DWord *relocDestination; // Pointer to the word to be relocated
 
@@ -973,6 +1023,9 @@ void ElfBinaryLoader::applyRelocations()
 
                 Address A = Address(elfRead4(relocDestination));
                 Address P = destNatOrigin + r_offset;
+
+                addRelocationSite(P, relType, symSectionIdx, symbolIdx);
+
                 Address S = assocSymbols != nullptr
                                 ? Address(elfRead4(&assocSymbols[symbolIdx].st_value))
                                 : Address::ZERO;
@@ -1057,70 +1110,79 @@ void ElfBinaryLoader::applyRelocations()
 }
 
 
-bool ElfBinaryLoader::isRelocationAt(Address addr)
+void ElfBinaryLoader::addRelocationSite(Address site, int relType, uint32 symSectionIdx,
+                                        DWord symbolIdx)
 {
-    if (m_loadedImage == nullptr) {
-        return false; // No file loaded
+    m_relocationSites.push_back({ site, relType, symSectionIdx, symbolIdx });
+}
+
+
+QString ElfBinaryLoader::getRelocationSymbolName(uint32 symSectionIdx, DWord symbolIdx) const
+{
+    QString symbolName;
+
+    if (symbolIdx != 0 && Util::inRange(symSectionIdx, 1UL, m_elfSections.size())) {
+        const SectionParam &symSection = m_elfSections[symSectionIdx];
+        const uint32 strSectionIdx     = m_shLink[symSectionIdx];
+
+        if (symbolIdx < symSection.Size / sizeof(Elf32_Sym) &&
+            Util::inRange(strSectionIdx, 1UL, m_elfSections.size())) {
+            const Elf32_Sym *sym = reinterpret_cast<const Elf32_Sym *>(
+                                       symSection.imagePtr.value()) +
+                                   symbolIdx;
+            const SectionParam &strSection = m_elfSections[strSectionIdx];
+            const DWord nameOffset         = elfRead4(&sym->st_name);
+
+            if (nameOffset < strSection.Size) {
+                symbolName = reinterpret_cast<const char *>(strSection.imagePtr.value()) +
+                             nameOffset;
+            }
+        }
     }
 
-    const Elf32_Half machine = elfRead2(&m_elfHeader->e_machine);
-    const Elf32_Half e_type  = elfRead2(&m_elfHeader->e_type); ///< relocation type
+    return symbolName;
+}
 
-    switch (machine) {
-    case EM_386:
 
-        for (size_t i = 1; i < m_elfSections.size(); ++i) {
-            const SectionParam &ps(m_elfSections[i]);
+const std::vector<BinaryRelocation> &ElfBinaryLoader::getRelocations() const
+{
+    if (m_relocationsIndexed) {
+        return m_relocations;
+    }
 
-            if (ps.sectionType == SHT_REL) {
-                // A section such as .rel.dyn or .rel.plt (without an addend field).
-                // Each entry has 2 words: r_offet and r_info. The r_offset is just the offset from
-                // the beginning of the section (section given by the section header's sh_info) to
-                // the word to be modified. r_info has the type in the bottom byte, and a symbol
-                // table index in the top 3 bytes. A symbol table offset of 0 (STN_UNDEF) means use
-                // value 0. The symbol table involved comes from the section header's sh_link field.
-                const Elf32_Rel *relocEntry = reinterpret_cast<Elf32_Rel *>(ps.imagePtr.value());
-                const DWord size            = ps.Size / sizeof(Elf32_Rel);
+    m_relocations.clear();
+    m_relocations.reserve(m_relocationSites.size());
 
-                // NOTE: the r_offset is different for .o files (E_REL in the e_type header field)
-                // than for exe's and shared objects!
-                Address destNatOrigin = Address::ZERO;
+    for (const RelocationSite &site : m_relocationSites) {
+        m_relocations.push_back(
+            { site.addr, site.type, getRelocationSymbolName(site.symSectionIdx, site.symbolIdx) });
+    }
 
-                if (e_type == ET_REL) {
-                    int destSection = m_shInfo[i];
-                    destNatOrigin   = m_elfSections[destSection].SourceAddr;
-                }
+    std::stable_sort(m_relocations.begin(), m_relocations.end(),
+                     [](const BinaryRelocation &a, const BinaryRelocation &b) {
+                         return a.addr < b.addr;
+                     });
 
-                for (DWord u = 0; u < size; u++) {
-                    Elf32_Addr r_offset = elfRead4(&relocEntry[u].r_offset);
+    m_relocationsIndexed = true;
+    return m_relocations;
+}
 
-                    Address relocDestination; // Pointer to the word to be relocated
 
-                    if (e_type == ET_REL) {
-                        relocDestination = destNatOrigin + r_offset;
-                    }
-                    else {
-                        const BinarySection *destSec = m_binaryImage->getSectionByAddr(
-                            Address(r_offset));
-                        if (destSec) {
-                            relocDestination = destSec->getSourceAddr() + r_offset;
-                            destNatOrigin    = Address::ZERO;
-                        }
-                    }
+bool ElfBinaryLoader::isRelocationAt(Address addr)
+{
+    return getRelocationAt(addr) != nullptr;
+}
 
-                    if (addr == relocDestination) {
-                        return true;
-                    }
-                }
-            }
-        }
 
-        break;
+const BinaryRelocation *ElfBinaryLoader::getRelocationAt(Address addr) const
+{
+    const std::vector<BinaryRelocation> &relocations = getRelocations();
 
-    default: LOG_WARN("Unhandled relocation!"); break; // Not implemented yet
-    }
+    auto it = std::lower_bound(
+        relocations.begin(), relocations.end(), addr,
+        [](const BinaryRelocation &reloc, Address a) { return reloc.addr < a; });
 
-    return false;
+    return (it != relocations.end() && it->addr == addr) ? &*it : nullptr;
 }
 
 
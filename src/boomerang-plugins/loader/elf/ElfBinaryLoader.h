@@ -70,6 +70,9 @@ public:
     /// \copydoc IFileLoader::isRelocationAt
     bool isRelocationAt(Address addr) override;
 
+    /// \copydoc IFileLoader::getRelocationAt
+    const BinaryRelocation *getRelocationAt(Address addr) const override;
+
 private:
     /// Reset internal state, except for those that keep track of which member
     /// we're up to
@@ -81,9 +84,22 @@ private:
     /// Return a list of library names which the binary file depends on
     QStringList getDependencyList();
 
-    // Apply relocations; important when compiled without -fPIC
+    /// Apply relocations; important when compiled without -fPIC.
+    /// Also records the relocation sites used by getRelocationAt.
     void applyRelocations();
 
+    /// Record a relocation site of type \p relType at \p site.
+    /// The target symbol is symbol \p symbolIdx of the symbol table section \p symSectionIdx.
+    void addRelocationSite(Address site, int relType, uint32 symSectionIdx, DWord symbolIdx);
+
+    /// \returns the name of symbol \p symbolIdx of the symbol table section \p symSectionIdx,
+    /// or the empty string if the symbol is invalid.
+    QString getRelocationSymbolName(uint32 symSectionIdx, DWord symbolIdx) const;
+
+    /// \returns all relocation sites, sorted by address.
+    /// The symbol names are resolved and the sites are sorted on the first call only.
+    const std::vector<BinaryRelocation> &getRelocations() const;
+
     /// Not meant to be used externally, but sometimes you just have to have it.
     /// Like a replacement for elf_strptr().
     /// If the string pointer could not be found, this function returns nullptr.
@@ -155,6 +171,23 @@ private:
     uint32 *m_shInfo       = nullptr;          ///< pointer to array of sh_info values
 
     std::vector<struct SectionParam> m_elfSections;
+
+    /// A relocation site as read from a REL/RELA section, before its symbol name is resolved.
+    struct RelocationSite
+    {
+        Address addr;
+        int type;
+        uint32 symSectionIdx;
+        DWord symbolIdx;
+    };
+
+    std::vector<RelocationSite> m_relocationSites; ///< All relocation sites, in file order
+
+    /// Cache of m_relocationSites with resolved symbol names, sorted by address.
+    /// Built by getRelocations().
+    mutable std::vector<BinaryRelocation> m_relocations;
+    mutable bool m_relocationsIndexed = false;
+
     BinaryImage *m_binaryImage   = nullptr;
     BinarySymbolTable *m_symbols = nullptr;
 };
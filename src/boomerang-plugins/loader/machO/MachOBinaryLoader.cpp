@@ -19,6 +19,7 @@
 #include "boomerang/db/binary/BinarySection.h"
 #include "boomerang/db/binary/BinarySymbol.h"
 #include "boomerang/db/binary/BinarySymbolTable.h"
+#include "boomerang/util/ByteUtil.h"
 #include "boomerang/util/log/Log.h"
 
 #include <QBuffer>
@@ -222,13 +223,11 @@ bool MachOBinaryLoader::loadFromMemory(QByteArray &img)
             fp.read(&strtbl[0], BMMH(syms.strsize));
             fp.seek(imgoffs + BMMH(syms.symoff));
 
-            for (unsigned n = 0; n < BMMH(syms.nsyms); n++) {
-                nlist sym;
-                fp.read(reinterpret_cast<char *>(&sym), sizeof(sym));
-                symbols.push_back(sym);
-                // DEBUG_PRINT(stdout, "got sym %s flags %x value %x\n", strtbl +
-                // BMMH(sym.n_un.n_strx), sym.n_type, BMMH(sym.n_value));
-            }
+            // Read all symbols at once. nlist mixes 8, 16 and 32 bit fields,
+            // so the fields are swapped when they are accessed.
+            const QByteArray rawSyms = fp.read(BMMH(syms.nsyms) * sizeof(nlist));
+            const nlist *firstSym    = reinterpret_cast<const nlist *>(rawSyms.constData());
+            symbols.insert(symbols.end(), firstSym, firstSym + rawSyms.size() / sizeof(nlist));
 
             DEBUG_PRINT("symtab contains %1 symbols", BMMH(syms.nsyms));
         } break;
@@ -249,13 +248,16 @@ bool MachOBinaryLoader::loadFromMemory(QByteArray &img)
             // nundef = BMMH(syms.nundefsym);
 
             DEBUG_PRINT("dysymtab has %1 indirect symbols: ", BMMH(syms.nindirectsyms));
-            indirectsymtbl.resize(BMMH(syms.nindirectsyms));
             fp.seek(imgoffs + BMMH(syms.indirectsymoff));
-            fp.read(reinterpret_cast<char *>(&indirectsymtbl[0]),
-                    indirectsymtbl.size() * sizeof(DWord));
+            const QByteArray rawIndirectSyms = fp.read(BMMH(syms.nindirectsyms) * sizeof(DWord));
+
+            // Convert the whole table to host byte order at once
+            indirectsymtbl.resize(rawIndirectSyms.size() / sizeof(DWord));
+            Util::readDWords(indirectsymtbl.data(), rawIndirectSyms.constData(),
+                             indirectsymtbl.size(), swap_bytes ? Endian::Big : Endian::Little);
 
-            for (unsigned j = 0; j < BMMH(syms.nindirectsyms); j++) {
-                DEBUG_PRINT("  %1 ", BMMH(indirectsymtbl[j]));
+            for (unsigned j = 0; j < indirectsymtbl.size(); j++) {
+                DEBUG_PRINT("  %1 ", indirectsymtbl[j]);
             }
         } break;
 
@@ -340,7 +342,7 @@ bool MachOBinaryLoader::loadFromMemory(QByteArray &img)
     for (unsigned j = 0; j < stubs_sects.size(); j++) {
         for (unsigned i = 0; i < BMMH(stubs_sects[j].size) / BMMH(stubs_sects[j].reserved2); i++) {
             unsigned startidx = BMMH(stubs_sects[j].reserved1);
-            unsigned symbol   = BMMH(indirectsymtbl[startidx + i]);
+            unsigned symbol   = indirectsymtbl[startidx + i];
             Address addr = Address(BMMH(stubs_sects[j].addr) + i * BMMH(stubs_sects[j].reserved2));
 
             DEBUG_PRINT("stub for %1 at %2", strtbl + BMMH(symbols[symbol].n_un.n_strx),
@@ -358,6 +360,8 @@ bool MachOBinaryLoader::loadFromMemory(QByteArray &img)
     }
 
     // process the remaining symbols
+    Symbols->reserve(static_cast<int>(symbols.size()));
+
     for (unsigned i = 0; i < symbols.size(); i++) {
         char *name = &strtbl.at(BMMH(symbols[i].n_un.n_strx));
 
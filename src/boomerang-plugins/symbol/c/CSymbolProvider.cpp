@@ -41,6 +41,12 @@ bool CSymbolProvider::readLibraryCatalog(const Prog *prog, const QString &filePa
         return false;
     }
 
+    // Library signatures depend on the machine; don't mix signatures of different programs.
+    if (prog->getMachine() != m_librarySignaturesMachine) {
+        m_librarySignatures.clear();
+        m_librarySignaturesMachine = prog->getMachine();
+    }
+
     QTextStream is(&file);
 
     while (!is.atEnd()) {
@@ -79,15 +85,24 @@ bool CSymbolProvider::readLibraryCatalog(const Prog *prog, const QString &filePa
 bool CSymbolProvider::readLibrarySignatures(const QString &signatureFile, const Prog *prog,
                                             CallConv cc)
 {
-    AnsiCParserDriver driver;
-    if (driver.parse(signatureFile, prog->getMachine(), cc) != 0) {
-        LOG_ERROR("Cannot read library signature file '%1'", signatureFile);
-        return false;
+    const auto key = std::make_tuple(signatureFile, prog->getMachine(), cc);
+    auto it        = m_parsedSignatureFiles.find(key);
+
+    if (it == m_parsedSignatureFiles.end()) {
+        AnsiCParserDriver driver;
+        if (driver.parse(signatureFile, prog->getMachine(), cc) != 0) {
+            LOG_ERROR("Cannot read library signature file '%1'", signatureFile);
+            return false;
+        }
+
+        it = m_parsedSignatureFiles.insert({ key, std::move(driver.signatures) }).first;
     }
 
-    for (std::shared_ptr<Signature> &signature : driver.signatures) {
-        m_librarySignatures[signature->getName()] = signature;
-        signature->setSigFilePath(signatureFile);
+    // Signatures may be modified during decompilation, so every program gets its own copy.
+    for (const std::shared_ptr<Signature> &signature : it->second) {
+        std::shared_ptr<Signature> sig = signature->clone();
+        sig->setSigFilePath(signatureFile);
+        m_librarySignatures[sig->getName()] = sig;
     }
 
     return true;
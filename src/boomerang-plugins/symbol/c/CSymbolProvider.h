@@ -11,11 +11,16 @@
 
 
 #include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/db/binary/BinaryFile.h"
 #include "boomerang/frontend/SigEnum.h"
 #include "boomerang/ifc/ISymbolProvider.h"
 
 #include <QMap>
 
+#include <list>
+#include <map>
+#include <tuple>
+
 
 class Prog;
 
@@ -42,5 +47,13 @@ private:
     bool readLibrarySignatures(const QString &signatureFile, const Prog *prog, CallConv cc);
 
 private:
+    /// Library signatures available to the current program
     QMap<QString, std::shared_ptr<Signature>> m_librarySignatures;
+    Machine m_librarySignaturesMachine = Machine::UNKNOWN;
+
+    /// Parsed signatures of all signature files read so far, by file, machine and
+    /// calling convention. Parsing signature files is expensive, so the result is kept
+    /// for subsequently loaded programs (e.g. when decompiling multiple binaries in batch mode).
+    std::map<std::tuple<QString, Machine, CallConv>, std::list<std::shared_ptr<Signature>>>
+        m_parsedSignatureFiles;
 };
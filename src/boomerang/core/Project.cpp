@@ -13,12 +13,23 @@
 #include "boomerang/core/Watcher.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/binary/BinarySymbolTable.h"
+#include "boomerang/db/module/Module.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/decomp/ProcDecompiler.h"
 #include "boomerang/decomp/ProgDecompiler.h"
 #include "boomerang/util/CallGraphDotWriter.h"
 #include "boomerang/util/ProgSymbolWriter.h"
 #include "boomerang/util/log/Log.h"
 
 
+/// Minimum time between two progress events
+static const std::chrono::milliseconds PROGRESS_EVENT_INTERVAL(100);
+
+/// Checking the clock for every decoded instruction is too expensive,
+/// so only check it every N instructions.
+static const int PROGRESS_CHECK_INSTRUCTIONS = 1024;
+
+
 Project::Project()
     : m_settings(new Settings())
     , m_pluginManager(new PluginManager(this))
@@ -156,6 +167,8 @@ bool Project::isBinaryLoaded() const
 
 void Project::unloadBinaryFile()
 {
+    m_pendingCallees.clear();
+    m_expandedCallees.clear();
     m_prog.reset();
     m_loadedBinary.reset();
 }
@@ -212,14 +225,112 @@ bool Project::decompileBinaryFile()
         return false;
     }
 
+    m_numDecompiledProcs = 0;
+    m_lastProgressEvent  = std::chrono::steady_clock::now();
+
     ProgDecompiler dcomp(m_prog.get());
     dcomp.decompile();
 
+    // everything is decompiled now
+    m_pendingCallees.clear();
+    m_expandedCallees.clear();
+
+    alertDecompilationEnd();
     return true;
 }
 
 
-bool Project::generateCode(Module *module)
+bool Project::decompileProc(UserProc *proc)
+{
+    if (!m_prog) {
+        LOG_ERROR("Cannot decompile procedure: No binary file is loaded.");
+        return false;
+    }
+    else if (!m_fe) {
+        LOG_ERROR("Cannot decompile procedure: No suitable frontend found.");
+        return false;
+    }
+    else if (proc == nullptr || proc->getProg() != m_prog.get()) {
+        LOG_ERROR("Cannot decompile procedure: Procedure is not part of the loaded program.");
+        return false;
+    }
+    else if (proc->isDecompiled()) {
+        return true;
+    }
+
+    m_lastProgressEvent = std::chrono::steady_clock::now();
+
+    ProcDecompiler dcomp;
+    dcomp.decompileSingle(proc);
+
+    if (!proc->isDecompiled()) {
+        LOG_WARN("Could not decompile procedure '%1'", proc->getName());
+        return false;
+    }
+
+    for (UserProc *callee : dcomp.getSummarizedCallees()) {
+        LOG_VERBOSE("Used summary for callee '%1' of '%2'", callee->getName(), proc->getName());
+        m_pendingCallees.push_back(callee);
+    }
+
+    return true;
+}
+
+
+bool Project::refineCallees(int maxProcs)
+{
+    int numDecompiled = 0;
+
+    while (numDecompiled < maxProcs && !m_pendingCallees.empty()) {
+        if (m_cancellationToken.isCancelled()) {
+            break;
+        }
+
+        UserProc *proc = m_pendingCallees.front();
+        if (proc->isDecompiled()) {
+            m_pendingCallees.pop_front();
+            m_expandedCallees.erase(proc);
+            continue;
+        }
+
+        if (proc->isDecoded() && m_expandedCallees.insert(proc).second) {
+            // Decompile the callees of proc first, so proc can be decompiled
+            // with the exact callee information.
+            bool queuedCallee = false;
+
+            for (Function *func : proc->getCallees()) {
+                if (func->isLib() || func == proc) {
+                    continue;
+                }
+
+                UserProc *callee = static_cast<UserProc *>(func);
+                if (!callee->isDecompiled() &&
+                    m_expandedCallees.find(callee) == m_expandedCallees.end()) {
+                    m_pendingCallees.push_front(callee);
+                    queuedCallee = true;
+                }
+            }
+
+            if (queuedCallee) {
+                continue;
+            }
+        }
+
+        // All callees are either decompiled or part of a recursion group with proc,
+        // which is handled by the recursive decompilation.
+        m_pendingCallees.pop_front();
+        m_expandedCallees.erase(proc);
+
+        LOG_VERBOSE("Refining callee '%1'", proc->getName());
+        proc->decompileRecursive();
+        numDecompiled++;
+    }
+
+    return !m_pendingCallees.empty();
+}
+
+
+bool Project::generateCode(Module *module, UserProc *proc)
 {
     if (!m_prog) {
         LOG_ERROR("Cannot generate code: No binary file is loaded.");
@@ -233,7 +344,26 @@ bool Project::generateCode(Module *module)
     LOG_MSG("Generating code...");
     for (auto &plugin : m_pluginManager->getPluginsByType(PluginType::CodeGenerator)) {
         ICodeGenerator *gen = plugin->getIfc<ICodeGenerator>();
-        gen->generateCode(getProg(), module);
+        gen->generateCode(getProg(), module, proc);
+    }
+
+    // Free the analysis data of the procedures code has been generated for
+    if (proc != nullptr) {
+        proc->compact();
+        return true;
+    }
+
+    // Generating code for the root module generates code for all modules
+    for (const auto &mod : m_prog->getModuleList()) {
+        if (module != nullptr && module != m_prog->getRootModule() && mod.get() != module) {
+            continue;
+        }
+
+        for (Function *func : *mod) {
+            if (!func->isLib()) {
+                static_cast<UserProc *>(func)->compact();
+            }
+        }
     }
 
     return true;
@@ -387,9 +517,20 @@ void Project::loadPlugins()
 }
 
 
-void Project::addWatcher(IWatcher *watcher)
+void Project::addWatcher(IWatcher *watcher, WatchGranularity granularity)
 {
     m_watchers.insert(watcher);
+
+    if (granularity == WatchGranularity::Instruction) {
+        m_instructionWatchers.insert(watcher);
+    }
+}
+
+
+void Project::removeWatcher(IWatcher *watcher)
+{
+    m_watchers.erase(watcher);
+    m_instructionWatchers.erase(watcher);
 }
 
 
@@ -427,9 +568,16 @@ void Project::alertSignatureUpdated(Function *function)
 
 void Project::alertInstructionDecoded(Address pc, int numBytes)
 {
-    for (IWatcher *it : m_watchers) {
+    m_numDecodedInstructions++;
+    m_numDecodedBytes += numBytes;
+
+    for (IWatcher *it : m_instructionWatchers) {
         it->onInstructionDecoded(pc, numBytes);
     }
+
+    if ((m_numDecodedInstructions % PROGRESS_CHECK_INSTRUCTIONS) == 0 && isProgressEventDue()) {
+        alertDecodeProgress();
+    }
 }
 
 
@@ -446,11 +594,19 @@ void Project::alertFunctionDecoded(Function *p, Address pc, Address last, int nu
     for (IWatcher *it : m_watchers) {
         it->onFunctionDecoded(p, pc, last, numBytes);
     }
+
+    if (isProgressEventDue()) {
+        alertDecodeProgress();
+    }
 }
 
 
 void Project::alertStartDecode(Address start, int numBytes)
 {
+    m_numDecodedInstructions = 0;
+    m_numDecodedBytes        = 0;
+    m_lastProgressEvent      = std::chrono::steady_clock::now();
+
     for (IWatcher *it : m_watchers) {
         it->onStartDecode(start, numBytes);
     }
@@ -459,6 +615,8 @@ void Project::alertStartDecode(Address start, int numBytes)
 
 void Project::alertEndDecode()
 {
+    alertDecodeProgress();
+
     for (IWatcher *it : m_watchers) {
         it->onEndDecode();
     }
@@ -483,9 +641,15 @@ void Project::alertProcStatusChanged(UserProc *proc)
 
 void Project::alertEndDecompile(UserProc *proc)
 {
+    m_numDecompiledProcs++;
+
     for (IWatcher *it : m_watchers) {
         it->onEndDecompile(proc);
     }
+
+    if (isProgressEventDue()) {
+        alertDecompileProgress();
+    }
 }
 
 
@@ -507,12 +671,40 @@ void Project::alertDecompiling(UserProc *proc)
 
 void Project::alertDecompilationEnd()
 {
+    alertDecompileProgress();
+
     for (IWatcher *w : m_watchers) {
         w->onDecompilationEnd();
     }
 }
 
 
+bool Project::isProgressEventDue() const
+{
+    return std::chrono::steady_clock::now() - m_lastProgressEvent >= PROGRESS_EVENT_INTERVAL;
+}
+
+
+void Project::alertDecodeProgress()
+{
+    m_lastProgressEvent = std::chrono::steady_clock::now();
+
+    for (IWatcher *w : m_watchers) {
+        w->onDecodeProgress(m_numDecodedInstructions, m_numDecodedBytes);
+    }
+}
+
+
+void Project::alertDecompileProgress()
+{
+    m_lastProgressEvent = std::chrono::steady_clock::now();
+
+    for (IWatcher *w : m_watchers) {
+        w->onDecompileProgress(m_numDecompiledProcs);
+    }
+}
+
+
 IFileLoader *Project::getBestLoader(const QString &filePath) const
 {
     QFile inputBinary(filePath);
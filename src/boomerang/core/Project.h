@@ -11,10 +11,14 @@
 
 
 #include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/core/Watcher.h"
 #include "boomerang/core/plugin/PluginManager.h"
 #include "boomerang/ifc/IFileLoader.h"
 #include "boomerang/util/Address.h"
+#include "boomerang/util/CancellationToken.h"
 
+#include <chrono>
+#include <deque>
 #include <memory>
 #include <set>
 #include <vector>
@@ -25,7 +29,6 @@ class Function;
 class ICodeGenerator;
 class IFrontEnd;
 class ITypeRecovery;
-class IWatcher;
 class Module;
 class Prog;
 class Settings;
@@ -63,6 +66,11 @@ public:
     PluginManager *getPluginManager();
     const PluginManager *getPluginManager() const;
 
+    /// Cancellation of decoding and decompilation. When cancelled, decoding and decompilation
+    /// stop early, and only completely decompiled procedures are emitted by code generation.
+    CancellationToken &getCancellationToken() { return m_cancellationToken; }
+    const CancellationToken &getCancellationToken() const { return m_cancellationToken; }
+
 public:
     /// \returns the library version string
     const char *getVersionStr() const;
@@ -117,16 +125,41 @@ public:
      */
     bool decompileBinaryFile();
 
+    /**
+     * Decompile only \p proc, e.g. when the user wants to look at a single procedure.
+     * Callees that are not decompiled yet are not decompiled first. Instead, calls to them
+     * are summarized by the signature of the callee if it is forced, or treated as using
+     * and defining all locations otherwise. These callees are queued for refinement
+     * by refineCallees(), so they are decompiled exactly when they are requested later.
+     * \returns true on success, false if no binary is decoded or an error occurred.
+     */
+    bool decompileProc(UserProc *proc);
+
+    /**
+     * Decompile the callees queued by decompileProc() bottom-up, one procedure at a time,
+     * so refinement can be interleaved with requests by the user.
+     * \param maxProcs maximum number of procedures to decompile.
+     * \returns true if there are callees left to refine.
+     */
+    bool refineCallees(int maxProcs = 1);
+
     /**
      * Generate code for \p module, or all modules if \p module is nullptr.
+     * If \p proc is not nullptr, only generate code for \p proc.
      * \returns true on success, false if no binary is decompiled or an error occurred.
      */
-    bool generateCode(Module *module = nullptr);
+    bool generateCode(Module *module = nullptr, UserProc *proc = nullptr);
 
 public:
     /// Register a watcher to receive events about the decompilation.
     /// Does NOT take ownership of the pointer.
-    void addWatcher(IWatcher *watcher);
+    /// \param granularity which progress events the watcher wants to receive.
+    void addWatcher(IWatcher *watcher,
+                    WatchGranularity granularity = WatchGranularity::Summary);
+
+    /// Unregister a watcher added by addWatcher.
+    /// Must be called before the watcher is destroyed if it does not outlive the project.
+    void removeWatcher(IWatcher *watcher);
 
     /// Called once after a function was created.
     void alertFunctionCreated(Function *function);
@@ -141,6 +174,8 @@ public:
     void alertStartDecode(Address start, int numBytes);
 
     /// Called every time an instruction is decoded.
+    /// Watchers not interested in single instructions are notified in regular intervals
+    /// about the total decoding progress instead.
     /// \param numBytes size of the instruction
     void alertInstructionDecoded(Address pc, int numBytes);
 
@@ -204,14 +239,37 @@ private:
      */
     bool decodeAll();
 
+    /// \returns true if enough time has passed since the last progress event
+    bool isProgressEventDue() const;
+
+    void alertDecodeProgress();
+    void alertDecompileProgress();
+
 private:
     std::unique_ptr<Settings> m_settings;
 
     /// The watchers which are interested in this decompilation.
     std::set<IWatcher *> m_watchers;
 
+    /// Watchers that want to be notified about every single decoded instruction.
+    std::set<IWatcher *> m_instructionWatchers;
+
+    int m_numDecodedInstructions = 0;
+    int m_numDecodedBytes        = 0;
+    int m_numDecompiledProcs     = 0;
+    std::chrono::steady_clock::time_point m_lastProgressEvent;
+
+    CancellationToken m_cancellationToken;
+
     std::unique_ptr<PluginManager> m_pluginManager;
 
+    /// Callees summarized by decompileProc() that still have to be decompiled.
+    /// Procedures are decompiled from the front of the queue.
+    std::deque<UserProc *> m_pendingCallees;
+
+    /// Procedures in m_pendingCallees whose callees have already been queued before them.
+    std::set<UserProc *> m_expandedCallees;
+
     std::unique_ptr<BinaryFile> m_loadedBinary;
     std::unique_ptr<Prog> m_prog;
 
@@ -87,6 +87,11 @@ public:
     bool assumeABI         = false; ///< Assume ABI compliance
     bool experimental      = false; ///< Activate experimental code. Caution!
 
+    /// Decompilation budget per procedure. Procedures exceeding the budget are finished
+    /// with a reduced pipeline (e.g. without type analysis). 0 means no limit.
+    int procTimeBudget = 0; ///< Maximum time (in seconds) spent decompiling a single procedure
+    int procStmtBudget = 0; ///< Maximum number of statements of a single procedure
+
     QString replayFile;  ///< file with commands to execute in interactive mode
     QString sslFileName; ///< Use this SSL file instead of one of the hard-coded ones.
 
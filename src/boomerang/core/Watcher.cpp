@@ -30,6 +30,11 @@ void IWatcher::onInstructionDecoded(Address, int)
 }
 
 
+void IWatcher::onDecodeProgress(int, int)
+{
+}
+
+
 void IWatcher::onBadDecode(Address)
 {
 }
@@ -65,6 +70,11 @@ void IWatcher::onEndDecompile(UserProc *)
 }
 
 
+void IWatcher::onDecompileProgress(int)
+{
+}
+
+
 void IWatcher::onFunctionDiscovered(Function *)
 {
 }
@@ -12,12 +12,23 @@
 
 #include "boomerang/core/BoomerangAPI.h"
 #include "boomerang/util/Address.h"
+#include "boomerang/util/Types.h"
 
 
 class Function;
 class UserProc;
 
 
+/// Determines which progress events a watcher receives.
+enum class WatchGranularity : uint8
+{
+    /// Only periodic progress summaries (\ref IWatcher::onDecodeProgress etc.)
+    Summary,
+    /// Additionally, one event for every decoded instruction.
+    Instruction
+};
+
+
 /// Virtual class to monitor the decompilation.
 class BOOMERANG_API IWatcher
 {
@@ -39,9 +50,15 @@ public:
     virtual void onStartDecode(Address start, int numBytes);
 
     /// Called every time an instruction is decoded.
+    /// Only called for watchers registered with WatchGranularity::Instruction.
     /// \param numBytes the size of the instruction.
     virtual void onInstructionDecoded(Address pc, int numBytes);
 
+    /// Called periodically during decoding, and once before decoding ends.
+    /// \param numInstructions number of instructions decoded since decoding started.
+    /// \param numBytes        number of bytes decoded since decoding started.
+    virtual void onDecodeProgress(int numInstructions, int numBytes);
+
     /// Called every time a function was decoded completely.
     virtual void onFunctionDecoded(Function *function, Address pc, Address last, int numBytes);
 
@@ -60,6 +77,10 @@ public:
     /// Called once for every completely decompiled proc \p proc
     virtual void onEndDecompile(UserProc *proc);
 
+    /// Called periodically during decompilation, and once before decompilation ends.
+    /// \param numProcsDecompiled number of procedures decompiled completely so far.
+    virtual void onDecompileProgress(int numProcsDecompiled);
+
     /// Called every time before middleDecompile is executed for \p function
     virtual void onFunctionDiscovered(Function *function);
 
@@ -103,12 +103,15 @@ void BasicBlock::setRTLs(std::unique_ptr<RTLList> rtls)
 {
     m_listOfRTLs = std::move(rtls);
     updateBBAddresses();
+    markModified();
 
     if (!m_listOfRTLs) {
         return;
     }
 
     for (auto &rtl : *m_listOfRTLs) {
+        rtl->setBB(this);
+
         for (Statement *stmt : *rtl) {
             assert(stmt != nullptr);
             stmt->setBB(this);
@@ -643,6 +646,7 @@ ImplicitAssign *BasicBlock::addImplicitAssign(const SharedExp &lhs)
 
     if (m_listOfRTLs->empty() || m_listOfRTLs->front()->getAddress() != Address::ZERO) {
         m_listOfRTLs->push_front(std::unique_ptr<RTL>(new RTL(Address::ZERO)));
+        m_listOfRTLs->front()->setBB(this);
     }
 
     // do not allow BB with 2 zero address RTLs
@@ -677,6 +681,7 @@ PhiAssign *BasicBlock::addPhi(const SharedExp &usedExp)
 
     if (m_listOfRTLs->empty() || m_listOfRTLs->front()->getAddress() != Address::ZERO) {
         m_listOfRTLs->push_front(std::unique_ptr<RTL>(new RTL(Address::ZERO)));
+        m_listOfRTLs->front()->setBB(this);
     }
 
     // do not allow BB with 2 zero address RTLs
@@ -771,5 +776,17 @@ void BasicBlock::removeRTL(RTL *rtl)
     if (it != m_listOfRTLs->end()) {
         m_listOfRTLs->erase(it);
         updateBBAddresses();
+        markModified();
+    }
+}
+
+
+void BasicBlock::markModified()
+{
+    if (m_function && !m_function->isLib()) {
+        ProcCFG *cfg = static_cast<UserProc *>(m_function)->getCFG();
+        if (cfg) {
+            cfg->markModified();
+        }
     }
 }
@@ -199,6 +199,10 @@ public:
      */
     void setRTLs(std::unique_ptr<RTLList> rtls);
 
+    /// Mark the statements of the CFG containing this BB as modified.
+    /// \sa ProcCFG::getModificationCount
+    void markModified();
+
     /**
      * Get first/next statement this BB
      * Somewhat intricate because of the post call semantics; these funcs save a lot of duplicated,
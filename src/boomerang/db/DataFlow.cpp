@@ -493,6 +493,26 @@ void DataFlow::findLiveAtDomPhi(int n, LocationSet &usedByDomPhi, LocationSet &u
 }
 
 
+void DataFlow::compact()
+{
+    std::vector<int>().swap(m_dfnum);
+    std::vector<int>().swap(m_semi);
+    std::vector<int>().swap(m_ancestor);
+    std::vector<int>().swap(m_samedom);
+    std::vector<int>().swap(m_vertex);
+    std::vector<int>().swap(m_parent);
+    std::vector<int>().swap(m_best);
+    std::vector<std::set<int>>().swap(m_bucket);
+    std::vector<std::set<int>>().swap(m_DF);
+    std::vector<ExSet>().swap(m_definedAt);
+
+    m_A_phi.clear();
+    m_defsites.clear();
+    m_defallsites.clear();
+    m_defStmts.clear();
+}
+
+
 void DataFlow::allocateData()
 {
     ProcCFG *cfg     = m_proc->getCFG();
@@ -57,6 +57,14 @@ public:
 
     void convertImplicits();
 
+    /**
+     * Free all data that is only needed for calculating dominance frontiers
+     * and placing phi functions. The dominator tree is kept, since renaming variables
+     * in the global analyses still needs it.
+     * Calling \ref calculateDominators() again recreates all data.
+     */
+    void compact();
+
     /**
      * Find the locations in the CFG used by a live, dominating phi-function; also removes dead
      * phi-funcions. Helper function for StatementPropagationPass.
@@ -23,6 +23,7 @@ DefCollector::~DefCollector()
 
 void DefCollector::clear()
 {
+    qDeleteAll(m_defs);
     m_defs.clear();
     m_initialised = false;
 }
@@ -31,16 +32,38 @@ void DefCollector::clear()
 void DefCollector::updateDefs(std::map<SharedExp, std::deque<Statement *>, lessExpStar> &Stacks,
                               UserProc *proc)
 {
+    // Locations already defined here. Definitions of the form foo@[x:y] also define foo.
+    // Note that m_defs itself cannot be searched, since the LHSs of the definitions
+    // may have been modified after they were inserted.
+    std::set<SharedExp, lessExpStar> definedLocs;
+
+    auto addDefinedLoc = [&definedLocs](const SharedExp &lhs) {
+        definedLocs.insert(lhs);
+
+        if (lhs->getOper() == opAt) {
+            definedLocs.insert(lhs->getSubExp1());
+        }
+    };
+
+    for (const Assign *def : m_defs) {
+        addDefinedLoc(def->getLeft());
+    }
+
     for (auto &Stack : Stacks) {
         if (Stack.second.empty()) {
             continue; // This variable's definition doesn't reach here
         }
+        else if (definedLocs.find(Stack.first) != definedLocs.end()) {
+            continue;
+        }
 
         // Create an assignment of the form loc := loc{def}
         auto re    = RefExp::get(Stack.first->clone(), Stack.second.back());
         Assign *as = new Assign(Stack.first->clone(), re);
         as->setProc(proc); // Simplify sometimes needs this
-        insert(as);
+
+        addDefinedLoc(as->getLeft());
+        m_defs.insert(as);
     }
 
     m_initialised = true;
@@ -91,6 +114,13 @@ void DefCollector::print(OStream &os) const
 
 SharedExp DefCollector::findDefFor(SharedExp e) const
 {
+    // Fast path. If the LHS of a definition was modified after insertion,
+    // the lookup might miss the definition, so search all definitions before giving up.
+    const Assign *found = m_defs.lookupLoc(e);
+    if (found && *found->getLeft() == *e) {
+        return found->getRight();
+    }
+
     for (Assign *def : m_defs) {
         SharedExp lhs = def->getLeft();
 
@@ -0,0 +1,185 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DefUseChains.h"
+
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/statements/Statement.h"
+#include "boomerang/util/LocationSet.h"
+#include "boomerang/util/StatementList.h"
+#include "boomerang/visitor/stmtexpvisitor/StmtDestCounter.h"
+
+
+void DefUseChains::build(const StatementList &stmts)
+{
+    clear();
+
+    for (Statement *stmt : stmts) {
+        // Don't count uses in implicit statements. There is no RHS of course,
+        // but you can still have x from m[x] on the LHS and so on, but these are not real uses
+        if (!stmt->isImplicit()) {
+            addUses(stmt);
+        }
+
+        addDestCounts(stmt);
+    }
+}
+
+
+void DefUseChains::clear()
+{
+    m_uses.clear();
+    m_usedDefs.clear();
+    m_destCounts.clear();
+    m_stmtDestCounts.clear();
+}
+
+
+const StatementSet &DefUseChains::getUses(Statement *def) const
+{
+    static const StatementSet noUses;
+
+    auto it = m_uses.find(def);
+    return it != m_uses.end() ? it->second : noUses;
+}
+
+
+int DefUseChains::getNumUses(Statement *def) const
+{
+    auto it = m_uses.find(def);
+    return it != m_uses.end() ? it->second.size() : 0;
+}
+
+
+void DefUseChains::updateStatement(Statement *stmt)
+{
+    removeUses(stmt);
+    removeDestCounts(stmt);
+
+    if (!stmt->isImplicit()) {
+        addUses(stmt);
+    }
+
+    addDestCounts(stmt);
+}
+
+
+StatementSet DefUseChains::removeStatement(Statement *stmt)
+{
+    StatementSet unusedDefs = removeUses(stmt);
+    removeDestCounts(stmt);
+
+    // Forget about the uses of stmt itself
+    auto useIt = m_uses.find(stmt);
+    if (useIt != m_uses.end()) {
+        for (Statement *user : useIt->second) {
+            auto it = m_usedDefs.find(user);
+            if (it != m_usedDefs.end()) {
+                it->second.remove(stmt);
+            }
+        }
+
+        m_uses.erase(useIt);
+    }
+
+    return unusedDefs;
+}
+
+
+void DefUseChains::addUses(Statement *stmt)
+{
+    LocationSet refs;
+    stmt->addUsedLocs(refs, false); // Ignore uses in collectors
+
+    for (const SharedExp &ref : refs) {
+        if (!ref->isSubscript()) {
+            continue;
+        }
+
+        Statement *def = ref->access<RefExp>()->getDef();
+
+        // Implicit definitions are counted as well; they are the ideal place
+        // to read off final parameters.
+        if (def) {
+            m_uses[def].insert(stmt);
+            m_usedDefs[stmt].insert(def);
+        }
+    }
+}
+
+
+StatementSet DefUseChains::removeUses(Statement *stmt)
+{
+    StatementSet unusedDefs;
+
+    auto usedIt = m_usedDefs.find(stmt);
+    if (usedIt == m_usedDefs.end()) {
+        return unusedDefs;
+    }
+
+    for (Statement *def : usedIt->second) {
+        auto useIt = m_uses.find(def);
+        if (useIt == m_uses.end()) {
+            continue;
+        }
+
+        useIt->second.remove(stmt);
+
+        if (useIt->second.empty()) {
+            m_uses.erase(useIt);
+            unusedDefs.insert(def);
+        }
+    }
+
+    m_usedDefs.erase(usedIt);
+    return unusedDefs;
+}
+
+
+void DefUseChains::addDestCounts(Statement *stmt)
+{
+    ExpDestCounter::ExpCountMap stmtCounts;
+    ExpDestCounter edc(stmtCounts);
+    StmtDestCounter sdc(&edc);
+    stmt->accept(&sdc);
+
+    if (stmtCounts.empty()) {
+        return;
+    }
+
+    for (const auto &[exp, count] : stmtCounts) {
+        m_destCounts[exp] += count;
+    }
+
+    m_stmtDestCounts[stmt] = std::move(stmtCounts);
+}
+
+
+void DefUseChains::removeDestCounts(Statement *stmt)
+{
+    auto stmtIt = m_stmtDestCounts.find(stmt);
+    if (stmtIt == m_stmtDestCounts.end()) {
+        return;
+    }
+
+    for (const auto &[exp, count] : stmtIt->second) {
+        auto it = m_destCounts.find(exp);
+        if (it == m_destCounts.end()) {
+            continue;
+        }
+
+        it->second -= count;
+
+        if (it->second <= 0) {
+            m_destCounts.erase(it);
+        }
+    }
+
+    m_stmtDestCounts.erase(stmtIt);
+}
@@ -0,0 +1,107 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/util/StatementSet.h"
+#include "boomerang/visitor/expvisitor/ExpDestCounter.h"
+
+#include <unordered_map>
+
+
+class StatementList;
+
+
+/**
+ * Def-use chains of a procedure in SSA form.
+ * For each definition, this keeps track of all statements using it,
+ * i.e. all statements containing a reference (RefExp) to the definition.
+ *
+ * The chains are built once from the statements of a procedure
+ * and are then updated incrementally when statements are modified or removed,
+ * so finding and counting the uses of a definition is O(uses)
+ * instead of O(size of the procedure).
+ *
+ * Additionally, this keeps track of how often each reference that can be propagated
+ * occurs in the procedure (\sa getDestCounts).
+ */
+class BOOMERANG_API DefUseChains
+{
+public:
+    DefUseChains()                          = default;
+    DefUseChains(const DefUseChains &other) = default;
+    DefUseChains(DefUseChains &&other)      = default;
+
+    ~DefUseChains() = default;
+
+    DefUseChains &operator=(const DefUseChains &other) = default;
+    DefUseChains &operator=(DefUseChains &&other) = default;
+
+public:
+    /**
+     * Build the chains from scratch for all statements in \p stmts.
+     * Uses in implicit statements and in collectors are not real uses and are ignored.
+     */
+    void build(const StatementList &stmts);
+
+    /// Remove all chains.
+    void clear();
+
+    /// \returns all statements that use the definition \p def.
+    const StatementSet &getUses(Statement *def) const;
+
+    /// \returns the number of statements that use the definition \p def.
+    int getNumUses(Statement *def) const;
+
+    /// \returns true if at least one statement uses the definition \p def.
+    bool isUsed(Statement *def) const { return getNumUses(def) > 0; }
+
+    /**
+     * \returns the number of times each reference that can be propagated
+     * occurs in the statements of the procedure (including phi statements).
+     * \sa Statement::propagateTo
+     */
+    const ExpDestCounter::ExpCountMap &getDestCounts() const { return m_destCounts; }
+
+    /**
+     * Update the uses of the statement \p stmt after it was modified in place
+     * (e.g. by propagating expressions into it). The uses of the definition
+     * made by \p stmt are not affected.
+     */
+    void updateStatement(Statement *stmt);
+
+    /**
+     * Remove the statement \p stmt from the chains, i.e. remove it from the uses
+     * of all definitions it references and forget about its own uses.
+     * \returns all definitions that were used by \p stmt, but are not used any more.
+     */
+    StatementSet removeStatement(Statement *stmt);
+
+private:
+    /// Add all uses of definitions in \p stmt.
+    void addUses(Statement *stmt);
+
+    /// Remove all uses of definitions in \p stmt.
+    /// \returns all definitions that were used by \p stmt, but are not used any more.
+    StatementSet removeUses(Statement *stmt);
+
+    /// Count the references in \p stmt that can be propagated.
+    void addDestCounts(Statement *stmt);
+
+    /// Undo addDestCounts for \p stmt.
+    void removeDestCounts(Statement *stmt);
+
+private:
+    std::unordered_map<Statement *, StatementSet> m_uses;     ///< def -> statements using def
+    std::unordered_map<Statement *, StatementSet> m_usedDefs; ///< stmt -> definitions used by stmt
+
+    ExpDestCounter::ExpCountMap m_destCounts; ///< \sa getDestCounts
+    std::unordered_map<Statement *, ExpDestCounter::ExpCountMap> m_stmtDestCounts; ///< per stmt
+};
@@ -587,6 +587,23 @@ int Prog::readNative4(Address a) const
 }
 
 
+const std::vector<DWord> &Prog::readSwitchTable(Address tableAddr, int numEntries) const
+{
+    std::vector<DWord> &entries = m_switchTables[tableAddr];
+    const int numCached         = static_cast<int>(entries.size());
+
+    if (numCached < numEntries) {
+        // read only the entries not read yet
+        entries.resize(numEntries);
+        const int numRead = m_binaryFile->getImage()->readNative4Array(
+            tableAddr + numCached * 4, entries.data() + numCached, numEntries - numCached);
+        entries.resize(numCached + numRead);
+    }
+
+    return entries;
+}
+
+
 void Prog::updateLibrarySignatures()
 {
     for (const auto &m : m_moduleList) {
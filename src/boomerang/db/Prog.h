@@ -25,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 
 class ArrayType;
@@ -153,6 +154,7 @@ public:
     Machine getMachine() const;
 
     void readDefaultLibraryCatalogues();
+
     bool addSymbolsFromSymbolFile(const QString &fname);
     std::shared_ptr<Signature> getLibSignature(const QString &name);
 
@@ -182,6 +184,15 @@ public:
 
     int readNative4(Address a) const;
 
+    /**
+     * Read the first \p numEntries 4 byte entries of the switch table at \p tableAddr.
+     * Tables are cached by address since restarting the decompilation of a procedure
+     * re-reads all of its switch tables.
+     * \returns the entries of the table. There are fewer than \p numEntries entries
+     * if the table extends past the end of its section.
+     */
+    const std::vector<DWord> &readSwitchTable(Address tableAddr, int numEntries) const;
+
     void updateLibrarySignatures();
 
 
@@ -261,4 +272,7 @@ private:
     // FIXME: is a set of Globals the most appropriate data structure? Surely not.
     GlobalSet m_globals;         ///< globals to print at code generation time
     DataIntervalMap m_globalMap; ///< Map from address to DataInterval (has size, name, type)
+
+    /// Entries of all switch tables read so far, by table address
+    mutable std::map<Address, std::vector<DWord>> m_switchTables;
 };
@@ -81,6 +81,12 @@ bool BinaryFile::isRelocationAt(Address addr) const
 }
 
 
+const BinaryRelocation *BinaryFile::getRelocationAt(Address addr) const
+{
+    return m_loader ? m_loader->getRelocationAt(addr) : nullptr;
+}
+
+
 Address BinaryFile::getJumpTarget(Address addr) const
 {
     return m_loader ? m_loader->getJumpTarget(addr) : Address::INVALID;
@@ -12,6 +12,8 @@
 
 #include "boomerang/util/Address.h"
 
+#include <QString>
+
 #include <memory>
 
 
@@ -46,6 +48,15 @@ enum class Machine : uint8_t
 };
 
 
+/// A single relocation site of a loaded binary file.
+struct BinaryRelocation
+{
+    Address addr = Address::INVALID; ///< Address of the relocated word
+    int type     = 0;                ///< Relocation type (format and machine dependent)
+    QString symbolName;              ///< Name of the target symbol, if any
+};
+
+
 /**
  * This class provides file-format independent access to loaded binary files.
  */
@@ -84,6 +95,9 @@ public:
     /// \returns true if \p addr is the destination of a relocated symbol.
     bool isRelocationAt(Address addr) const;
 
+    /// \returns the relocation at address \p addr, or nullptr if there is none.
+    const BinaryRelocation *getRelocationAt(Address addr) const;
+
     /// \returns the destination of a jump at address \p addr, taking relocation into account
     Address getJumpTarget(Address addr) const;
 
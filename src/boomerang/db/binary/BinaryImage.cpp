@@ -92,6 +92,29 @@ DWord BinaryImage::readNative4(Address addr) const
 }
 
 
+int BinaryImage::readNative4Array(Address addr, DWord *values, int count) const
+{
+    const BinarySection *si = getSectionByAddr(addr);
+
+    if (si == nullptr || si->getHostAddr() == HostAddress::INVALID) {
+        LOG_WARN("Invalid read at address %1: Address is not mapped to a section", addr.toString());
+        return 0;
+    }
+
+    const Address sectEnd = si->getSourceAddr() + si->getSize();
+    const Byte *host      = reinterpret_cast<const Byte *>(
+        (si->getHostAddr() - si->getSourceAddr() + addr).value());
+
+    int i = 0;
+    for (; i < count && addr + (i + 1) * 4 <= sectEnd; i++) {
+        values[i] = si->isAddressBss(addr + i * 4) ? 0x00000000
+                                                   : Util::readDWord(host + i * 4, si->getEndian());
+    }
+
+    return i;
+}
+
+
 QWord BinaryImage::readNative8(Address addr) const
 {
     const BinarySection *si = getSectionByAddr(addr);
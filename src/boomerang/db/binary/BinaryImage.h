@@ -110,6 +110,15 @@ public:
     DWord readNative4(Address addr) const;
     QWord readNative8(Address addr) const;
 
+    /**
+     * Read \p count consecutive 4 byte values starting at \p addr into \p values.
+     * The section is looked up only once, so this is much faster than calling
+     * readNative4 for each value (e.g. when reading switch tables).
+     * Reading stops at the end of the section.
+     * \returns the number of values read.
+     */
+    int readNative4Array(Address addr, DWord *values, int count) const;
+
     bool readNativeFloat4(Address addr, float &value) const;
     bool readNativeFloat8(Address addr, double &value) const;
 
@@ -29,64 +29,79 @@ BinarySymbolTable::~BinarySymbolTable()
 void BinarySymbolTable::clear()
 {
     m_addrIndex.clear();
-    m_symbolList.clear();
     m_nameIndex.clear();
+    m_symbolList.clear();
+    m_symbols.clear();
+}
+
+
+void BinarySymbolTable::reserve(int numSymbols)
+{
+    if (numSymbols <= 0) {
+        return;
+    }
+
+    const std::size_t totalSymbols = m_symbolList.size() + numSymbols;
+
+    m_addrIndex.reserve(totalSymbols);
+    m_nameIndex.reserve(static_cast<int>(totalSymbols));
+    m_symbolList.reserve(totalSymbols);
 }
 
 
 BinarySymbol *BinarySymbolTable::createSymbol(Address addr, const QString &name, bool local)
 {
-    if (m_addrIndex.find(addr) != m_addrIndex.end()) {
+    if (m_addrIndex.find(addr.value()) != m_addrIndex.end()) {
         return nullptr; // symbol already exists
     }
 
     // If the symbol already exists, redirect the new symbol to the old one.
-    std::map<QString, std::shared_ptr<BinarySymbol>>::iterator it = m_nameIndex.find(name);
+    auto it = m_nameIndex.constFind(name);
 
-    if (it != m_nameIndex.end()) {
+    if (it != m_nameIndex.constEnd()) {
         LOG_WARN("Symbol '%1' already exists in the global symbol table!", name);
-        std::shared_ptr<BinarySymbol> existingSymbol = it->second;
-        m_addrIndex[addr]                            = existingSymbol;
-        return existingSymbol.get();
+        BinarySymbol *existingSymbol = it.value();
+        m_addrIndex[addr.value()]    = existingSymbol;
+        return existingSymbol;
     }
 
-    std::shared_ptr<BinarySymbol> sym = std::make_shared<BinarySymbol>(addr, name);
-    m_addrIndex[addr]                 = sym;
+    m_symbols.emplace_back(addr, name);
+    BinarySymbol *sym         = &m_symbols.back();
+    m_addrIndex[addr.value()] = sym;
 
     if (!local) {
-        m_nameIndex[name] = sym;
+        // use the name of the symbol as key to share the string data
+        m_nameIndex.insert(sym->getName(), sym);
     }
 
-    m_symbolList.push_back(sym.get());
-    return sym.get();
+    m_symbolList.push_back(sym);
+    return sym;
 }
 
 
 BinarySymbol *BinarySymbolTable::findSymbolByAddress(Address addr)
 {
-    auto ff = m_addrIndex.find(addr);
-    return (ff != m_addrIndex.end()) ? ff->second.get() : nullptr;
+    auto ff = m_addrIndex.find(addr.value());
+    return (ff != m_addrIndex.end()) ? ff->second : nullptr;
 }
 
 
 const BinarySymbol *BinarySymbolTable::findSymbolByAddress(Address addr) const
 {
-    auto ff = m_addrIndex.find(addr);
-    return (ff != m_addrIndex.end()) ? ff->second.get() : nullptr;
+    auto ff = m_addrIndex.find(addr.value());
+    return (ff != m_addrIndex.end()) ? ff->second : nullptr;
 }
 
 
 BinarySymbol *BinarySymbolTable::findSymbolByName(const QString &name)
 {
-    auto ff = m_nameIndex.find(name);
-    return (ff != m_nameIndex.end()) ? ff->second.get() : nullptr;
+    return m_nameIndex.value(name, nullptr);
 }
 
 
 const BinarySymbol *BinarySymbolTable::findSymbolByName(const QString &name) const
 {
-    auto ff = m_nameIndex.find(name);
-    return (ff != m_nameIndex.end()) ? ff->second.get() : nullptr;
+    return m_nameIndex.value(name, nullptr);
 }
 
 
@@ -97,23 +112,22 @@ bool BinarySymbolTable::renameSymbol(const QString &oldName, const QString &newN
     }
 
     auto oldIt = m_nameIndex.find(oldName);
-    auto newIt = m_nameIndex.find(newName);
 
     if (oldIt == m_nameIndex.end()) { // symbol not found
         LOG_ERROR("Could not rename symbol '%1' to '%2': A symbol with name '%1' was not found.",
                   oldName, newName);
         return false;
     }
-    else if (newIt != m_nameIndex.end()) { // symbol name clash
+    else if (m_nameIndex.contains(newName)) { // symbol name clash
         LOG_ERROR("Could not rename symbol '%1' to '%2': A symbol with name '%2' already exists",
                   oldName, newName);
         return false;
     }
 
-    std::shared_ptr<BinarySymbol> oldSymbol = oldIt->second;
+    BinarySymbol *oldSymbol = oldIt.value();
     m_nameIndex.erase(oldIt);
-    oldSymbol->m_name    = newName;
-    m_nameIndex[newName] = oldSymbol;
+    oldSymbol->m_name = newName;
+    m_nameIndex.insert(oldSymbol->getName(), oldSymbol);
 
     return true;
 }
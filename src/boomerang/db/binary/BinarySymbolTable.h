@@ -10,24 +10,24 @@
 #pragma once
 
 
+#include "boomerang/db/binary/BinarySymbol.h"
 #include "boomerang/util/Address.h"
 
-#include <map>
-#include <memory>
-#include <vector>
-
+#include <QHash>
+#include <QString>
 
-class BinarySymbol;
+#include <deque>
+#include <unordered_map>
+#include <vector>
 
 
 /**
  * A simple class to implement a symbol table than can be looked up by address or by name.
  *
- * \note Can't readily use operator[] overloaded for address and string parameters.
- * The main problem is that when you do symtab[0x100] = "main", the string map
- * doesn't see the string. If you have one of the maps be a pointer to the other string
- * and use a special comparison operator, then if the strings are ever changed,
- * then the map's internal rb-tree becomes invalid.
+ * Symbols are stored in a single contiguous pool and are indexed by hash tables,
+ * so loading binaries with many symbols does not allocate multiple tree nodes per symbol.
+ * Symbol names are stored only once, since the keys of the name index share
+ * their data with the names of the symbols.
  */
 class BOOMERANG_API BinarySymbolTable
 {
@@ -64,6 +64,13 @@ public:
     bool empty() const { return m_symbolList.empty(); }
     void clear();
 
+    /**
+     * Prepare the symbol table for adding \p numSymbols symbols.
+     * Loaders should call this before adding all symbols of a binary,
+     * so the indexes do not have to grow while the symbols are added.
+     */
+    void reserve(int numSymbols);
+
     /// Creates a symbol if it does not exist.
     BinarySymbol *createSymbol(Address addr, const QString &name, bool local = false);
 
@@ -77,11 +84,15 @@ public:
     bool renameSymbol(const QString &oldName, const QString &newName);
 
 private:
-    /// The map indexed by address.
-    std::map<Address, std::shared_ptr<BinarySymbol>> m_addrIndex;
+    /// All symbols of this table. Symbols are never moved once they are created.
+    std::deque<BinarySymbol> m_symbols;
+
+    /// The index by address.
+    std::unordered_map<Address::value_type, BinarySymbol *> m_addrIndex;
 
-    /// The map indexed by string. Note that the strings are stored twice.
-    std::map<QString, std::shared_ptr<BinarySymbol>> m_nameIndex;
+    /// The index by name. Does not contain local symbols.
+    QHash<QString, BinarySymbol *> m_nameIndex;
 
+    /// All symbols, in the order they were created
     SymbolList m_symbolList;
 };
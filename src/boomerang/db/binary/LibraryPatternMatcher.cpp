@@ -0,0 +1,296 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "LibraryPatternMatcher.h"
+
+#include "boomerang/db/binary/BinaryImage.h"
+#include "boomerang/db/binary/BinarySection.h"
+#include "boomerang/db/binary/BinarySymbol.h"
+#include "boomerang/db/binary/BinarySymbolTable.h"
+#include "boomerang/util/log/Log.h"
+
+#include <QFile>
+#include <QStringList>
+#include <QTextStream>
+
+#include <algorithm>
+
+
+LibraryPatternMatcher::LibraryPatternMatcher()
+{
+    m_nodes.emplace_back(); // root
+}
+
+
+bool LibraryPatternMatcher::loadPatternFile(const QString &filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QFile::ReadOnly | QFile::Text)) {
+        return false;
+    }
+
+    QTextStream ts(&file);
+    int numInvalid = 0;
+
+    while (!ts.atEnd()) {
+        const QString line = ts.readLine().trimmed();
+
+        if (line.startsWith("---")) {
+            break;
+        }
+        else if (!line.isEmpty() && !addPattern(line)) {
+            numInvalid++;
+        }
+    }
+
+    if (numInvalid > 0) {
+        LOG_WARN("Ignored %1 invalid patterns in pattern file '%2'", numInvalid, filePath);
+    }
+
+    return true;
+}
+
+
+bool LibraryPatternMatcher::addPattern(const QString &line)
+{
+    const QStringList fields = line.simplified().split(' ');
+    if (fields.size() < 6) {
+        return false;
+    }
+
+    const QString &bytes = fields[0];
+    if (bytes.length() != 2 * PATTERN_LENGTH) {
+        return false;
+    }
+
+    bool crcLenOk = false, crcOk = false, totalOk = false;
+    Pattern pattern;
+    pattern.crcLength   = fields[1].toUInt(&crcLenOk, 16);
+    pattern.crc         = fields[2].toUShort(&crcOk, 16);
+    pattern.totalLength = fields[3].toUInt(&totalOk, 16);
+    pattern.name        = fields[5];
+
+    if (!crcLenOk || !crcOk || !totalOk || pattern.name.isEmpty()) {
+        return false;
+    }
+    else if (pattern.crcLength == 0 || pattern.crcLength > 0xFF ||
+             pattern.totalLength < PATTERN_LENGTH + pattern.crcLength) {
+        // The function is too short to be recognized reliably, or the pattern is malformed
+        return false;
+    }
+
+    // parse the leading bytes first so that invalid patterns do not leave nodes in the trie
+    std::vector<int> values(PATTERN_LENGTH, -1); // -1: any byte
+    int numFixedBytes = 0;
+
+    for (int i = 0; i < PATTERN_LENGTH; i++) {
+        const QString byteStr = bytes.mid(2 * i, 2);
+        if (byteStr == "..") {
+            continue;
+        }
+
+        bool ok          = false;
+        const uint value = byteStr.toUInt(&ok, 16);
+        if (!ok) {
+            return false;
+        }
+
+        values[i] = static_cast<int>(value);
+        numFixedBytes++;
+    }
+
+    if (numFixedBytes < MIN_FIXED_BYTES) {
+        return false;
+    }
+
+    int node = 0;
+    for (int value : values) {
+        node = getOrCreateChild(node, value);
+    }
+
+    m_nodes[node].patterns.push_back(static_cast<int>(m_patterns.size()));
+    m_patterns.push_back(pattern);
+
+    if (values[0] < 0) {
+        m_firstBytes.set();
+    }
+    else {
+        m_firstBytes.set(values[0]);
+    }
+
+    return true;
+}
+
+
+int LibraryPatternMatcher::match(const Byte *data, std::size_t size) const
+{
+    if (size == 0 || !m_firstBytes.test(data[0])) {
+        return -1;
+    }
+
+    return matchNode(0, 0, data, size);
+}
+
+
+int LibraryPatternMatcher::markLibraryFunctions(const BinaryImage *image,
+                                                BinarySymbolTable *symbols) const
+{
+    if (m_patterns.empty()) {
+        return 0;
+    }
+
+    int numFound = 0;
+
+    for (const BinarySection *section : *image) {
+        if (!section->isCode() || section->getHostAddr() == HostAddress::INVALID) {
+            continue;
+        }
+
+        const Byte *data       = reinterpret_cast<const Byte *>(section->getHostAddr().value());
+        const std::size_t size = section->getSize();
+
+        for (std::size_t i = 0; i < size;) {
+            const int idx = m_firstBytes.test(data[i]) ? matchNode(0, 0, data + i, size - i) : -1;
+            if (idx < 0) {
+                i++;
+                continue;
+            }
+
+            const Pattern &pattern = m_patterns[idx];
+            const Address funcAddr = section->getSourceAddr() + i;
+
+            if (symbols->findSymbolByAddress(funcAddr) != nullptr) {
+                // Never override symbol information of the binary; the function might only
+                // look like the library function.
+                i++;
+                continue;
+            }
+            else if (symbols->findSymbolByName(pattern.name) != nullptr) {
+                // The same function cannot be linked twice; this is a false positive.
+                i++;
+                continue;
+            }
+
+            BinarySymbol *sym = symbols->createSymbol(funcAddr, pattern.name);
+
+            LOG_VERBOSE("Recognized library function '%1' at address %2", sym->getName(),
+                        funcAddr);
+
+            sym->setAttribute("Function", true);
+            sym->setAttribute("StaticFunction", true);
+            numFound++;
+
+            // functions do not overlap
+            i += std::max<std::size_t>(pattern.totalLength, 1);
+        }
+    }
+
+    return numFound;
+}
+
+
+SWord LibraryPatternMatcher::crc16(const Byte *data, std::size_t size)
+{
+    if (size == 0) {
+        return 0;
+    }
+
+    unsigned int crc = 0xFFFF;
+
+    for (std::size_t i = 0; i < size; i++) {
+        unsigned int value = data[i];
+
+        for (int bit = 0; bit < 8; bit++) {
+            if ((crc ^ value) & 1) {
+                crc = (crc >> 1) ^ 0x8408;
+            }
+            else {
+                crc >>= 1;
+            }
+
+            value >>= 1;
+        }
+    }
+
+    crc = ~crc & 0xFFFF;
+    return static_cast<SWord>(((crc << 8) | (crc >> 8)) & 0xFFFF);
+}
+
+
+int LibraryPatternMatcher::findChild(int node, Byte value) const
+{
+    const std::vector<std::pair<Byte, int>> &children = m_nodes[node].children;
+
+    auto it = std::lower_bound(children.begin(), children.end(), value,
+                               [](const std::pair<Byte, int> &child, Byte val) {
+                                   return child.first < val;
+                               });
+
+    return (it != children.end() && it->first == value) ? it->second : -1;
+}
+
+
+int LibraryPatternMatcher::getOrCreateChild(int node, int value)
+{
+    int child = (value < 0) ? m_nodes[node].wildcardChild
+                            : findChild(node, static_cast<Byte>(value));
+
+    if (child >= 0) {
+        return child;
+    }
+
+    child = static_cast<int>(m_nodes.size());
+    m_nodes.emplace_back(); // invalidates references into m_nodes
+
+    if (value < 0) {
+        m_nodes[node].wildcardChild = child;
+    }
+    else {
+        std::vector<std::pair<Byte, int>> &children = m_nodes[node].children;
+        const std::pair<Byte, int> newChild(static_cast<Byte>(value), child);
+        children.insert(std::upper_bound(children.begin(), children.end(), newChild), newChild);
+    }
+
+    return child;
+}
+
+
+int LibraryPatternMatcher::matchNode(int node, int depth, const Byte *data, std::size_t size) const
+{
+    if (depth == PATTERN_LENGTH) {
+        for (int idx : m_nodes[node].patterns) {
+            const Pattern &pattern = m_patterns[idx];
+
+            // totalLength >= PATTERN_LENGTH + crcLength, see addPattern
+            if (size < pattern.totalLength ||
+                crc16(data + PATTERN_LENGTH, pattern.crcLength) != pattern.crc) {
+                continue;
+            }
+
+            return idx;
+        }
+
+        return -1;
+    }
+    else if (static_cast<std::size_t>(depth) >= size) {
+        // all patterns are PATTERN_LENGTH bytes long
+        return -1;
+    }
+
+    const int child = findChild(node, data[depth]);
+    if (child >= 0) {
+        const int result = matchNode(child, depth + 1, data, size);
+        if (result >= 0) {
+            return result;
+        }
+    }
+
+    const int wildcard = m_nodes[node].wildcardChild;
+    return (wildcard >= 0) ? matchNode(wildcard, depth + 1, data, size) : -1;
+}
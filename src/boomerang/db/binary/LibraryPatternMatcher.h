@@ -0,0 +1,129 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/util/Types.h"
+
+#include <QString>
+
+#include <bitset>
+#include <vector>
+
+
+class BinaryImage;
+class BinarySymbolTable;
+
+
+/**
+ * Recognizes statically linked library functions by their leading bytes.
+ *
+ * Patterns are read from files in the format of FLIRT .pat files. Each line describes
+ * one function:
+ * \code
+ * 5589E583EC..8B4508... 1E 4A5B 00C0 :0000 name
+ * \endcode
+ * i.e. the first 32 bytes of the function in hex ('..' for bytes that vary,
+ * like relocated addresses), the length and CRC16 of the bytes following
+ * the first 32 bytes, the total length of the function, and the name of the function.
+ * Further fields on the line are ignored. A line starting with "---" ends the file.
+ *
+ * To avoid false positives, patterns of functions that are too short to have
+ * a CRC (i.e. a CRC length of 0), and patterns with less than MIN_FIXED_BYTES
+ * non-variable leading bytes are rejected.
+ *
+ * All patterns are merged into a trie, so the code of a section can be scanned
+ * in a single pass regardless of the number of patterns.
+ *
+ * \note The matcher is not run when loading a binary yet, since there are no pattern files
+ * generated from real static libraries.
+ */
+class BOOMERANG_API LibraryPatternMatcher
+{
+public:
+    /// Length of the leading byte pattern of each function
+    static constexpr int PATTERN_LENGTH = 32;
+
+    /// Minimum number of leading bytes of a pattern that must not vary
+    static constexpr int MIN_FIXED_BYTES = PATTERN_LENGTH / 2;
+
+public:
+    LibraryPatternMatcher();
+    LibraryPatternMatcher(const LibraryPatternMatcher &other) = default;
+    LibraryPatternMatcher(LibraryPatternMatcher &&other)      = default;
+
+    ~LibraryPatternMatcher() = default;
+
+    LibraryPatternMatcher &operator=(const LibraryPatternMatcher &other) = default;
+    LibraryPatternMatcher &operator=(LibraryPatternMatcher &&other) = default;
+
+public:
+    /// Read all patterns from the pattern file \p filePath.
+    /// \returns false if the file could not be read.
+    bool loadPatternFile(const QString &filePath);
+
+    /// Add a single pattern given as a line of a pattern file.
+    /// \returns false if \p line is not a valid pattern.
+    bool addPattern(const QString &line);
+
+    int getNumPatterns() const { return static_cast<int>(m_patterns.size()); }
+
+    /**
+     * Check if a function of the pattern database starts at \p data.
+     * \param data start of the code to check
+     * \param size number of bytes available at \p data
+     * \returns the index of the matching pattern, or -1 if no pattern matches.
+     */
+    int match(const Byte *data, std::size_t size) const;
+
+    /// \returns the name of the function described by the pattern at index \p idx
+    const QString &getPatternName(int idx) const { return m_patterns[idx].name; }
+
+    /**
+     * Scan all code sections of \p image for library functions that do not have a symbol yet.
+     * Symbols are created for all recognized functions and marked as static library functions.
+     * Functions that already have a symbol are left alone, even if they match a pattern.
+     * \returns the number of recognized functions.
+     */
+    int markLibraryFunctions(const BinaryImage *image, BinarySymbolTable *symbols) const;
+
+    /// CRC16 as used by FLIRT pattern files.
+    static SWord crc16(const Byte *data, std::size_t size);
+
+private:
+    struct Pattern
+    {
+        QString name;
+        std::size_t crcLength;
+        SWord crc;
+        std::size_t totalLength;
+    };
+
+    struct TrieNode
+    {
+        std::vector<std::pair<Byte, int>> children; ///< sorted by byte value
+        int wildcardChild = -1;
+        std::vector<int> patterns; ///< Patterns ending at this node (only at full depth)
+    };
+
+    /// \returns the index of the child of \p node for \p value, or -1 if there is none.
+    int findChild(int node, Byte value) const;
+    int getOrCreateChild(int node, int value);
+
+    int matchNode(int node, int depth, const Byte *data, std::size_t size) const;
+
+private:
+    std::vector<Pattern> m_patterns;
+    std::vector<TrieNode> m_nodes;
+
+    /// Possible values of the first byte of a function, to quickly reject most positions.
+    std::bitset<256> m_firstBytes;
+};
@@ -82,6 +82,9 @@ public:
     /// Add to the set of callers
     void addCaller(CallStatement *caller) { m_callers.insert(caller); }
 
+    /// Remove from the set of callers, e.g. when \p caller is deleted
+    void removeCaller(CallStatement *caller) { m_callers.erase(caller); }
+
     void removeParameterFromSignature(SharedExp e);
 
     /// Rename the first parameter named \p oldName to \p newName.
@@ -14,11 +14,15 @@
 #include "boomerang/db/signature/Parameter.h"
 #include "boomerang/ssl/RTL.h"
 #include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/ssl/statements/ImplicitAssign.h"
+#include "boomerang/ssl/statements/PhiAssign.h"
 #include "boomerang/util/log/Log.h"
 
 #include <QtAlgorithms>
 
+#include <algorithm>
 #include <cassert>
 
 
@@ -42,7 +46,9 @@ void ProcCFG::clear()
     // But this has to wait until the decoder redesign.
 
     m_bbStartMap.clear();
+    m_bbs.clear();
     m_implicitMap.clear();
+    markModified();
     m_entryBB    = nullptr;
     m_exitBB     = nullptr;
     m_wellFormed = true;
@@ -55,15 +61,9 @@ bool ProcCFG::hasBB(const BasicBlock *bb) const
         return false;
     }
 
-    // we have to use linear search here, since the bb might already have been deleted
+    // Only compare the pointer, since the bb might already have been deleted
     // (invoking UB when calling getLowAddr).
-    for (const auto &val : m_bbStartMap) {
-        if (val.second == bb) {
-            return true;
-        }
-    }
-
-    return false;
+    return m_bbs.find(bb) != m_bbs.end();
 }
 
 
@@ -283,12 +283,19 @@ void ProcCFG::removeBB(BasicBlock *bb)
         return;
     }
 
-    BBStartMap::iterator bbIt = m_bbStartMap.find(bb->getLowAddr());
-    if (bbIt != m_bbStartMap.end()) {
-        m_bbStartMap.erase(bbIt);
+    // There might be multiple BBs starting at the same address (e.g. orphaned BBs),
+    // so make sure to remove the right one.
+    auto range = m_bbStartMap.equal_range(bb->getLowAddr());
+    for (BBStartMap::iterator bbIt = range.first; bbIt != range.second; ++bbIt) {
+        if (bbIt->second == bb) {
+            m_bbStartMap.erase(bbIt);
+            break;
+        }
     }
 
+    m_bbs.erase(bb);
     delete bb;
+    markModified();
 }
 
 
@@ -472,27 +479,50 @@ void ProcCFG::removeImplicitAssign(SharedExp x)
 
 BasicBlock *ProcCFG::splitBB(BasicBlock *bb, Address splitAddr, BasicBlock *_newBB /* = 0 */)
 {
+    RTLList *bbRTLs = bb->getRTLs();
     RTLList::iterator splitIt;
 
     // First find which RTL has the split address; note that this could fail
     // (e.g. jump into the middle of an instruction, or some weird delay slot effects)
-    for (splitIt = bb->getRTLs()->begin(); splitIt != bb->getRTLs()->end(); ++splitIt) {
-        if ((*splitIt)->getAddress() == splitAddr) {
-            break;
+    // The RTLs are sorted by address (except for RTLs with address 0, which are never
+    // split targets), so search from the end that is closer to the split address.
+    const Address::value_type lowAddr = bb->getLowAddr().value();
+    const Address::value_type midAddr = lowAddr + (bb->getHiAddr().value() - lowAddr) / 2;
+
+    if (splitAddr.value() <= midAddr) {
+        splitIt = std::find_if(bbRTLs->begin(), bbRTLs->end(),
+                               [splitAddr](const std::unique_ptr<RTL> &rtl) {
+                                   return rtl->getAddress() == splitAddr;
+                               });
+    }
+    else {
+        auto revIt = std::find_if(bbRTLs->rbegin(), bbRTLs->rend(),
+                                  [splitAddr](const std::unique_ptr<RTL> &rtl) {
+                                      return rtl->getAddress() == splitAddr;
+                                  });
+
+        splitIt = (revIt != bbRTLs->rend()) ? std::prev(revIt.base()) : bbRTLs->end();
+
+        // Several RTLs can have the same address (e.g. SPARC instructions with delay slots).
+        // Like the forward search, split before the first of them.
+        while (splitIt != bbRTLs->end() && splitIt != bbRTLs->begin() &&
+               (*std::prev(splitIt))->getAddress() == splitAddr) {
+            --splitIt;
         }
     }
 
-    if (splitIt == bb->getRTLs()->end()) {
+    if (splitIt == bbRTLs->end()) {
         LOG_WARN("Cannot split BB at address %1 at split address %2", bb->getLowAddr(), splitAddr);
         return bb;
     }
 
+    // RTLs are moved to or deleted from the high part
+    markModified();
+
     if (_newBB && !_newBB->isIncomplete()) {
         // we already have a BB for the high part. Delete overlapping RTLs and adjust edges.
 
-        while (splitIt != bb->getRTLs()->end()) {
-            splitIt = bb->getRTLs()->erase(splitIt); // deletes RTLs
-        }
+        bbRTLs->erase(splitIt, bbRTLs->end()); // deletes RTLs
 
         bb->updateBBAddresses();
         _newBB->updateBBAddresses();
@@ -517,11 +547,7 @@ BasicBlock *ProcCFG::splitBB(BasicBlock *bb, Address splitAddr, BasicBlock *_new
     // We don't want to "deep copy" the RTLs themselves,
     // because we want to transfer ownership from the original BB to the "high" part
     std::unique_ptr<RTLList> highRTLs(new RTLList);
-    for (RTLList::iterator it = splitIt; it != bb->getRTLs()->end();) {
-        highRTLs->push_back(std::move(*it));
-        assert(*it == nullptr);
-        it = bb->getRTLs()->erase(it);
-    }
+    highRTLs->splice(highRTLs->end(), *bbRTLs, splitIt, bbRTLs->end());
 
     _newBB->setRTLs(std::move(highRTLs));
     bb->updateBBAddresses();
@@ -556,14 +582,88 @@ void ProcCFG::print(OStream &out)
     out << '\n';
 }
 
+const std::vector<Statement *> &ProcCFG::getStatements() const
+{
+    updateStatementIndex();
+    return m_stmtIndex;
+}
+
+
+const std::vector<PhiAssign *> &ProcCFG::getPhis() const
+{
+    updateStatementIndex();
+    return m_phiIndex;
+}
+
+
+const std::vector<CallStatement *> &ProcCFG::getCalls() const
+{
+    updateStatementIndex();
+    return m_callIndex;
+}
+
+
+const std::vector<Assign *> &ProcCFG::getAssigns() const
+{
+    updateStatementIndex();
+    return m_assignIndex;
+}
+
+
+void ProcCFG::updateStatementIndex() const
+{
+    if (m_stmtIndexValid && m_stmtIndexTimestamp == m_modificationCount) {
+        return;
+    }
+
+    m_stmtIndex.clear();
+    m_phiIndex.clear();
+    m_callIndex.clear();
+    m_assignIndex.clear();
+
+    for (const BasicBlock *bb : *this) {
+        const RTLList *rtls = bb->getRTLs();
+        if (!rtls) {
+            continue;
+        }
+
+        for (const auto &rtl : *rtls) {
+            for (Statement *stmt : *rtl) {
+                if (stmt->getProc() == nullptr) {
+                    stmt->setProc(m_myProc);
+                }
+
+                m_stmtIndex.push_back(stmt);
+
+                if (stmt->isPhi()) {
+                    m_phiIndex.push_back(static_cast<PhiAssign *>(stmt));
+                }
+                else if (stmt->isCall()) {
+                    m_callIndex.push_back(static_cast<CallStatement *>(stmt));
+                }
+                else if (stmt->isAssign()) {
+                    m_assignIndex.push_back(static_cast<Assign *>(stmt));
+                }
+            }
+        }
+    }
+
+    m_stmtIndexValid     = true;
+    m_stmtIndexTimestamp = m_modificationCount;
+}
+
+
 void ProcCFG::insertBB(BasicBlock *bb)
 {
     assert(bb != nullptr);
     assert(bb->getLowAddr() != Address::INVALID);
+    markModified();
+
     if (bb->getLowAddr() != Address::ZERO) {
         auto it = m_bbStartMap.find(bb->getLowAddr());
         if (it != m_bbStartMap.end()) {
             // replace it
+            m_bbs.erase(it->second);
             it->second = bb;
         }
         else {
@@ -575,4 +675,6 @@ void ProcCFG::insertBB(BasicBlock *bb)
         // this is an orpahned BB (e.g. delay slot)
         m_bbStartMap.insert({ Address::ZERO, bb });
     }
+
+    m_bbs.insert(bb);
 }
@@ -17,12 +17,17 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <unordered_set>
+#include <vector>
 
 
 class Function;
 class UserProc;
 class BasicBlock;
 class Statement;
+class Assign;
+class CallStatement;
+class PhiAssign;
 class RTL;
 class Parameter;
 
@@ -233,6 +238,35 @@ public:
      */
     BasicBlock *splitBB(BasicBlock *bb, Address splitAddr, BasicBlock *newBB = nullptr);
 
+public:
+    /**
+     * \returns all statements in this CFG, in the order of the BBs and RTLs.
+     * The statements are cached and only collected again when statements or BBs
+     * have been added or removed since the last call (\sa getModificationCount).
+     * Any such modification invalidates the returned reference,
+     * so take a copy (e.g. via UserProc::getStatements) when modifying the CFG while iterating.
+     */
+    const std::vector<Statement *> &getStatements() const;
+
+    /// \returns all phi assignments in this CFG. \sa getStatements
+    const std::vector<PhiAssign *> &getPhis() const;
+
+    /// \returns all call statements in this CFG. \sa getStatements
+    const std::vector<CallStatement *> &getCalls() const;
+
+    /// \returns all ordinary assignments in this CFG. \sa getStatements
+    const std::vector<Assign *> &getAssigns() const;
+
+    /**
+     * \returns a counter that is incremented whenever statements are added to, removed from
+     * or replaced in the RTLs of this CFG, or RTLs or BBs are added or removed.
+     * Caches of statements (like the statement index) use this to detect changes.
+     */
+    uint64 getModificationCount() const { return m_modificationCount; }
+
+    /// Mark the statements of this CFG as modified. \sa getModificationCount
+    void markModified() { m_modificationCount++; }
+
 public:
     /// print this CFG, mainly for debugging
     void print(OStream &out);
@@ -240,9 +274,13 @@ public:
 private:
     void insertBB(BasicBlock *bb);
 
+    /// Collect all statements again if the cached statements are out of date.
+    void updateStatementIndex() const;
+
 private:
     UserProc *m_myProc = nullptr;    ///< Procedure to which this CFG belongs.
     BBStartMap m_bbStartMap;         ///< The Address to BB map
+    std::unordered_set<const BasicBlock *> m_bbs; ///< All BBs in m_bbStartMap, for hasBB()
     BasicBlock *m_entryBB = nullptr; ///< The CFG entry BasicBlock.
     BasicBlock *m_exitBB  = nullptr; ///< The CFG exit BasicBlock.
 
@@ -254,4 +292,14 @@ private:
     /// (e.g. with ad-hoc global assignment)
     bool m_implicitsDone      = false;
     mutable bool m_wellFormed = false;
+
+    /// Cached statements; see getStatements()
+    mutable std::vector<Statement *> m_stmtIndex;
+    mutable std::vector<PhiAssign *> m_phiIndex;
+    mutable std::vector<CallStatement *> m_callIndex;
+    mutable std::vector<Assign *> m_assignIndex;
+    mutable bool m_stmtIndexValid       = false;
+    mutable uint64 m_stmtIndexTimestamp = 0; ///< m_modificationCount at time of caching
+
+    uint64 m_modificationCount = 0; ///< \sa getModificationCount
 };
@@ -21,6 +21,7 @@
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Location.h"
 #include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/exp/Terminal.h"
 #include "boomerang/ssl/exp/Ternary.h"
 #include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/ssl/statements/ImplicitAssign.h"
@@ -145,6 +146,39 @@ void UserProc::decompileRecursive()
 }
 
 
+void UserProc::compact()
+{
+    if (m_status < ProcStatus::FinalDone) {
+        return;
+    }
+
+    m_df.compact();
+    m_recurPremises.clear();
+    m_defUseChains.clear();
+    m_defUseChainsValid = false;
+
+    if (m_status < ProcStatus::CodegenDone) {
+        // The global analyses still need the collectors of the calls
+        return;
+    }
+
+    for (BasicBlock *bb : *m_cfg) {
+        if (bb->getType() != BBType::Call) {
+            continue;
+        }
+
+        BasicBlock::RTLRIterator rrit;
+        StatementList::reverse_iterator srit;
+        CallStatement *call = dynamic_cast<CallStatement *>(bb->getLastStmt(rrit, srit));
+
+        if (call != nullptr) {
+            call->getDefCollector()->clear();
+            call->getUseCollector()->clear();
+        }
+    }
+}
+
+
 void UserProc::numberStatements() const
 {
     int stmtNumber = 0;
@@ -161,15 +195,43 @@ void UserProc::numberStatements() const
 
 void UserProc::getStatements(StatementList &stmts) const
 {
-    for (const BasicBlock *bb : *m_cfg) {
-        bb->appendStatementsTo(stmts);
+    for (Statement *s : m_cfg->getStatements()) {
+        stmts.append(s);
     }
+}
 
-    for (Statement *s : stmts) {
-        if (s->getProc() == nullptr) {
-            s->setProc(const_cast<UserProc *>(this));
-        }
+
+DefUseChains &UserProc::getDefUseChains()
+{
+    if (!m_defUseChainsValid || m_defUseChainsTimestamp != m_cfg->getModificationCount()) {
+        StatementList stmts;
+        getStatements(stmts);
+
+        m_defUseChains.build(stmts);
+        m_defUseChainsValid     = true;
+        m_defUseChainsTimestamp = m_cfg->getModificationCount();
+    }
+
+    return m_defUseChains;
+}
+
+
+/// \returns true if \p exp contains a reference to the definition \p def.
+/// Note that unlike RefExp wildcard searches, this does not treat references to
+/// implicit definitions (def == nullptr) as references to an implicit assignment \p def.
+static bool containsRefTo(const SharedExp &exp, const Statement *def)
+{
+    if (!exp) {
+        return false;
     }
+    else if (exp->isSubscript() && exp->access<RefExp>()->getDef() == def) {
+        return true;
+    }
+
+    const int arity = exp->getArity();
+    return (arity >= 1 && containsRefTo(exp->getSubExp1(), def)) ||
+           (arity >= 2 && containsRefTo(exp->getSubExp2(), def)) ||
+           (arity >= 3 && containsRefTo(exp->getSubExp3(), def));
 }
 
 
@@ -179,18 +241,11 @@ bool UserProc::removeStatement(Statement *stmt)
         return false;
     }
 
-    // remove anything proven about this statement
+    // remove anything proven about this statement.
+    // Search for references to stmt directly instead of collecting all used locations.
     for (auto provenIt = m_provenTrue.begin(); provenIt != m_provenTrue.end();) {
-        LocationSet refs;
-        provenIt->second->addUsedLocs(refs);
-        provenIt->first->addUsedLocs(
-            refs); // Could be say m[esp{99} - 4] on LHS and we are deleting stmt 99
-
-        auto it = std::find_if(refs.begin(), refs.end(), [stmt](const SharedExp &ref) {
-            return ref->isSubscript() && ref->access<RefExp>()->getDef() == stmt;
-        });
-
-        if (it != refs.end()) {
+        // Could be say m[esp{99} - 4] on LHS and we are deleting stmt 99
+        if (containsRefTo(provenIt->second, stmt) || containsRefTo(provenIt->first, stmt)) {
             LOG_VERBOSE("Removing proven true exp %1 = %2 that uses statement being removed.",
                         provenIt->first, provenIt->second);
 
@@ -207,10 +262,19 @@ bool UserProc::removeStatement(Statement *stmt)
         return false;
     }
 
+    const bool chainsUpToDate = m_defUseChainsValid &&
+                                m_defUseChainsTimestamp == m_cfg->getModificationCount();
+
     for (auto &rtl : *bb->getRTLs()) {
         for (RTL::iterator it = rtl->begin(); it != rtl->end(); ++it) {
             if (*it == stmt) {
                 rtl->erase(it);
+
+                if (chainsUpToDate) {
+                    m_defUseChains.removeStatement(stmt);
+                    m_defUseChainsTimestamp = m_cfg->getModificationCount();
+                }
+
                 return true;
             }
         }
@@ -862,6 +926,10 @@ bool UserProc::searchAndReplace(const Exp &search, SharedExp replace)
         ch |= s->searchAndReplace(search, replace);
     }
 
+    if (ch) {
+        invalidateDefUseChains();
+    }
+
     return ch;
 }
 
@@ -874,16 +942,7 @@ void UserProc::markAsInitialParam(const SharedExp &loc)
 
 bool UserProc::allPhisHaveDefs() const
 {
-    StatementList stmts;
-    getStatements(stmts);
-
-    for (const Statement *stmt : stmts) {
-        if (!stmt->isPhi()) {
-            continue; // Might be able to optimise this a bit
-        }
-
-        const PhiAssign *pa = static_cast<const PhiAssign *>(stmt);
-
+    for (const PhiAssign *pa : m_cfg->getPhis()) {
         for (const auto &ref : *pa) {
             if (!ref.getDef()) {
                 return false;
@@ -1483,13 +1542,8 @@ bool UserProc::prover(SharedExp query, std::set<PhiAssign *> &lastPhis,
             // find a memory def for the right if there is a memof on the left
             // FIXME: this seems pretty much like a bad hack!
             if (!change && query->getSubExp1()->isMemOf()) {
-                StatementList stmts;
-                getStatements(stmts);
-
-                for (Statement *s : stmts) {
-                    Assign *as = dynamic_cast<Assign *>(s);
-
-                    if (as && (*as->getRight() == *query->getSubExp2()) &&
+                for (Assign *as : m_cfg->getAssigns()) {
+                    if ((*as->getRight() == *query->getSubExp2()) &&
                         as->getLeft()->isMemOf()) {
                         query->setSubExp2(as->getLeft()->clone());
                         change = true;
@@ -11,6 +11,7 @@
 
 
 #include "boomerang/db/DataFlow.h"
+#include "boomerang/db/DefUseChains.h"
 #include "boomerang/db/UseCollector.h"
 #include "boomerang/db/proc/Proc.h"
 #include "boomerang/db/proc/ProcCFG.h"
@@ -98,6 +99,18 @@ public:
     DataFlow *getDataFlow() { return &m_df; }
     const DataFlow *getDataFlow() const { return &m_df; }
 
+    /**
+     * \returns the def-use chains of this procedure. The chains are built on first use
+     * and rebuilt when statements have been added or removed since. Code that modifies
+     * statements in place, inside or outside of a pass, must update them
+     * or call invalidateDefUseChains().
+     * \sa IPass::preservesDefUseChains
+     */
+    DefUseChains &getDefUseChains();
+
+    /// Discard the def-use chains; they are rebuilt by the next call to getDefUseChains().
+    void invalidateDefUseChains() { m_defUseChainsValid = false; }
+
     const std::shared_ptr<ProcSet> &getRecursionGroup() { return m_recursionGroup; }
     void setRecursionGroup(const std::shared_ptr<ProcSet> &recursionGroup)
     {
@@ -114,6 +127,11 @@ public:
     /// Records that this procedure has been decoded.
     void setDecoded();
 
+    /// \returns true if this procedure exceeded its decompilation budget
+    /// and is decompiled with a reduced pipeline.
+    bool isDegraded() const { return m_degraded; }
+    void setDegraded(bool degraded) { m_degraded = degraded; }
+
     bool isEarlyRecursive() const
     {
         return m_recursionGroup != nullptr && m_status <= ProcStatus::InCycle;
@@ -137,6 +155,15 @@ public:
     /// Decompile this procedure, and all callees.
     void decompileRecursive();
 
+    /**
+     * Free analysis data that is no longer needed once this procedure is decompiled.
+     * After final decompilation, the phi placement data and recursion premises are freed.
+     * After code generation, the collectors of all calls are freed as well.
+     * Data needed by code generation and by callers of this procedure
+     * (signature, parameters, return statement and proven preservations) is kept.
+     */
+    void compact();
+
 public:
     // statement related
 
@@ -146,7 +173,8 @@ public:
     /// \returns all statements in this UserProc
     void getStatements(StatementList &stmts) const;
 
-    /// Remove (but not delete) \p stmt from this UserProc
+    /// Remove (but not delete) \p stmt from this UserProc.
+    /// Up to date def-use chains are updated accordingly.
     /// \returns true iff successfully removed
     bool removeStatement(Statement *stmt);
 
@@ -385,12 +413,17 @@ private:
     ProcStatus m_status = ProcStatus::Undecoded;
     int m_nextLocal     = 0; ///< Number of the next local. Can't use locals.size() because some get
                              ///< deleted
+    bool m_degraded     = false; ///< \sa isDegraded
 
     std::unique_ptr<ProcCFG> m_cfg; ///< The control flow graph.
 
     /// DataFlow object. Holds information relevant to transforming to and from SSA form.
     DataFlow m_df;
 
+    DefUseChains m_defUseChains;            ///< \sa getDefUseChains
+    bool m_defUseChainsValid       = false; ///< false if the chains must be rebuilt
+    uint64 m_defUseChainsTimestamp = 0;     ///< CFG modification count when last built
+
     /**
      * The list of parameters, ordered and filtered.
      * Note that a LocationList could be used, but then there would be nowhere
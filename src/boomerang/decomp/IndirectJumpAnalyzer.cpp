@@ -26,6 +26,8 @@
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ConstGlobalConverter.h"
 
+#include <map>
+
 
 // clang-format off
 // Switch High Level patterns
@@ -136,6 +138,81 @@ static const SharedConstExp vfc_none = Location::memOf(Location::memOf(Terminal:
 static const SharedConstExp hlVfc[] = { vfc_funcptr, vfc_both, vfc_vto, vfc_vfo, vfc_none };
 
 
+/**
+ * Finds the first pattern of a list of patterns that matches an expression, ignoring subscripts.
+ * Patterns are indexed by their top level operator, so an expression is only compared
+ * to the patterns that can possibly match it instead of to all of them.
+ * The top level operator of each pattern must not be a wildcard.
+ */
+class PatternMatcher
+{
+public:
+    void addPattern(const SharedConstExp &pattern)
+    {
+        const int idx = static_cast<int>(m_patterns.size());
+        m_patterns.push_back(pattern);
+        m_patternsByOper[getTopOper(pattern.get())].push_back(idx);
+    }
+
+    /// \returns the index of the first pattern matching \p e, or -1 if no pattern matches.
+    int findMatch(const SharedConstExp &e) const
+    {
+        auto it = m_patternsByOper.find(getTopOper(e.get()));
+        if (it == m_patternsByOper.end()) {
+            return -1;
+        }
+
+        for (int idx : it->second) {
+            if (e->equalNoSubscript(*m_patterns[idx])) {
+                return idx;
+            }
+        }
+
+        return -1;
+    }
+
+private:
+    static OPER getTopOper(const Exp *e)
+    {
+        while (e->isSubscript()) {
+            e = e->getSubExp1().get();
+        }
+
+        return e->getOper();
+    }
+
+private:
+    std::vector<SharedConstExp> m_patterns;
+    std::map<OPER, std::vector<int>> m_patternsByOper;
+};
+
+
+static PatternMatcher makeSwitchFormMatcher()
+{
+    PatternMatcher matcher;
+    for (const SwitchForm &form : hlForms) {
+        matcher.addPattern(form.pattern);
+    }
+
+    return matcher;
+}
+
+
+static PatternMatcher makeVfcMatcher()
+{
+    PatternMatcher matcher;
+    for (const SharedConstExp &pattern : hlVfc) {
+        matcher.addPattern(pattern);
+    }
+
+    return matcher;
+}
+
+
+static const PatternMatcher hlFormMatcher = makeSwitchFormMatcher();
+static const PatternMatcher hlVfcMatcher  = makeVfcMatcher();
+
+
 /// Find all the possible constant values that the location defined by s could be assigned with
 static void findConstantValues(const Statement *s, std::list<int> &dests)
 {
@@ -316,21 +393,22 @@ bool IndirectJumpAnalyzer::decodeIndirectJmp(BasicBlock *bb, UserProc *proc)
         // use an alias-safe incremental propagation, but for now we'll assume no alias problems and
         // force the propagation
         bool convert = false;
-        lastStmt->propagateTo(convert, proc->getProg()->getProject()->getSettings(), nullptr,
-                              nullptr, true /* force */);
+        if (lastStmt->propagateTo(convert, proc->getProg()->getProject()->getSettings(), nullptr,
+                                  nullptr, true /* force */)) {
+            // The case statement was changed outside of a pass
+            proc->invalidateDefUseChains();
+        }
+
         SharedExp jumpDest = lastStmt->getDest();
 
         SwitchType switchType = SwitchType::Invalid;
+        const int formIdx     = hlFormMatcher.findMatch(jumpDest);
 
-        for (auto &val : hlForms) {
-            if (jumpDest->equalNoSubscript(*val.pattern)) {
-                switchType = val.type;
+        if (formIdx >= 0) {
+            switchType = hlForms[formIdx].type;
 
-                if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
-                    LOG_MSG("Indirect jump matches form %1", static_cast<char>(switchType));
-                }
-
-                break;
+            if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
+                LOG_MSG("Indirect jump matches form %1", static_cast<char>(switchType));
             }
         }
 
@@ -349,11 +427,14 @@ bool IndirectJumpAnalyzer::decodeIndirectJmp(BasicBlock *bb, UserProc *proc)
                 // findNumCases() thinks is the number of cases, when finding the first array
                 // element not pointing to code.
                 if (switchType == SwitchType::A) {
-                    const Prog *prog = proc->getProg();
+                    const Prog *prog                = proc->getProg();
+                    const std::vector<DWord> &table = prog->readSwitchTable(swi->tableAddr,
+                                                                            swi->numTableEntries);
 
                     for (int entryIdx = 0; entryIdx < swi->numTableEntries; ++entryIdx) {
-                        Address switchEntryAddr = Address(
-                            prog->readNative4(swi->tableAddr + entryIdx * 4));
+                        Address switchEntryAddr = entryIdx < static_cast<int>(table.size())
+                                                      ? Address(table[entryIdx])
+                                                      : Address::ZERO;
 
                         if (!Util::inRange(switchEntryAddr, prog->getLimitTextLow(),
                                            prog->getLimitTextHigh())) {
@@ -464,27 +545,17 @@ bool IndirectJumpAnalyzer::decodeIndirectJmp(BasicBlock *bb, UserProc *proc)
                     e);
         }
 
-        int n           = sizeof(hlVfc) / sizeof(SharedExp);
-        bool recognised = false;
-        int i;
-
-        for (i = 0; i < n; i++) {
-            if (e->equalNoSubscript(*hlVfc[i])) {
-                recognised = true;
-
-                if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
-                    LOG_MSG("Indirect call matches form %1", i);
-                }
-
-                break;
-            }
-        }
-
-        if (!recognised) {
+        const int i = hlVfcMatcher.findMatch(e);
+        if (i < 0) {
             return false;
         }
+        else if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
+            LOG_MSG("Indirect call matches form %1", i);
+        }
 
         lastStmt->setDest(e); // Keep the changes to the indirect call expression
+        proc->invalidateDefUseChains();
+
         int K1, K2;
         SharedExp vtExp, t1;
         Prog *prog = proc->getProg();
@@ -731,6 +802,12 @@ void IndirectJumpAnalyzer::processSwitch(BasicBlock *bb, UserProc *proc)
     // be a goto to the code for case 3, but a smarter back end could group them
     std::list<Address> dests;
 
+    // Tables of 4 byte entries are read all at once.
+    static const std::vector<DWord> noTable;
+    const bool isSimpleTable = si->switchType != SwitchType::H && si->switchType != SwitchType::F;
+    const std::vector<DWord> &table = isSimpleTable ? prog->readSwitchTable(si->tableAddr, numCases)
+                                                    : noTable;
+
     for (int i = 0; i < numCases; i++) {
         // Get the destination address from the switch table.
         if (si->switchType == SwitchType::H) {
@@ -748,7 +825,8 @@ void IndirectJumpAnalyzer::processSwitch(BasicBlock *bb, UserProc *proc)
             switchDestination = Address(entry[i]);
         }
         else {
-            switchDestination = Address(prog->readNative4(si->tableAddr + i * 4));
+            switchDestination = i < static_cast<int>(table.size()) ? Address(table[i])
+                                                                   : Address::ZERO;
         }
 
         if ((si->switchType == SwitchType::O) || (si->switchType == SwitchType::R) ||
@@ -23,6 +23,11 @@
 #include "boomerang/util/log/SeparateLogger.h"
 
 
+/// Maximum number of pass executions when iterating the return update passes to a fixpoint.
+/// Used to be a fixed 3 iterations of 5 pass executions each.
+static constexpr int MAX_RETURN_UPDATE_PASS_RUNS = 40;
+
+
 ProcDecompiler::ProcDecompiler()
 {
 }
@@ -34,6 +39,16 @@ void ProcDecompiler::decompileRecursive(UserProc *proc)
 }
 
 
+void ProcDecompiler::decompileSingle(UserProc *proc)
+{
+    m_summarizeCallees = true;
+    m_summarizedCallees.clear();
+
+    tryDecompileRecursive(proc);
+    m_summarizeCallees = false;
+}
+
+
 ProcStatus ProcDecompiler::tryDecompileRecursive(UserProc *proc)
 {
     /* Cycle detection logic:
@@ -90,6 +105,11 @@ ProcStatus ProcDecompiler::tryDecompileRecursive(UserProc *proc)
 
     Project *project = proc->getProg()->getProject();
 
+    if (project->getCancellationToken().isCancelled()) {
+        // Do not start decompiling any more procedures
+        return proc->getStatus();
+    }
+
     LOG_MSG("%1 procedure '%2'",
             (proc->getStatus() >= ProcStatus::Visited) ? "Re-visiting" : "Visiting",
             proc->getName());
@@ -120,7 +140,7 @@ ProcStatus ProcDecompiler::tryDecompileRecursive(UserProc *proc)
         printCallStack();
     }
 
-    if (project->getSettings()->decodeChildren) {
+    if (project->getSettings()->decodeChildren || m_summarizeCallees) {
         // Recurse to callees first, to perform a depth first search
         for (BasicBlock *bb : *proc->getCFG()) {
             if (bb->getType() != BBType::Call) {
@@ -148,6 +168,17 @@ ProcStatus ProcDecompiler::tryDecompileRecursive(UserProc *proc)
                 call->setCalleeReturn(callee->getRetStmt());
                 continue;
             }
+            else if (m_summarizeCallees) {
+                // Leave the call childless, so it uses the forced signature of the callee,
+                // or uses and defines everything.
+                if (callee != proc && std::find(m_summarizedCallees.begin(),
+                                                m_summarizedCallees.end(),
+                                                callee) == m_summarizedCallees.end()) {
+                    m_summarizedCallees.push_back(callee);
+                }
+
+                continue;
+            }
 
             // check if the callee has already been visited but not done (apart from global
             // analyses). This means that we have found a new cycle or a part of an existing cycle
@@ -205,6 +236,14 @@ ProcStatus ProcDecompiler::tryDecompileRecursive(UserProc *proc)
         }
     }
 
+    if (project->getCancellationToken().isCancelled()) {
+        // Leave the procedure undecompiled; no code will be generated for it.
+        LOG_MSG("Decompilation cancelled, not decompiling '%1'", proc->getName());
+        assert(m_callStack.back() == proc);
+        m_callStack.pop_back();
+        return proc->getStatus();
+    }
+
     // if no callee is involved in recursion
     if (proc->getStatus() != ProcStatus::InCycle) {
         project->alertDecompiling(proc);
@@ -213,6 +252,13 @@ ProcStatus ProcDecompiler::tryDecompileRecursive(UserProc *proc)
         earlyDecompile(proc);
         middleDecompile(proc);
 
+        if (proc->getStatus() < ProcStatus::MiddleDone &&
+            project->getCancellationToken().isCancelled()) {
+            // Decompilation was restarted after analysing indirect jumps, and then cancelled
+            m_callStack.pop_back();
+            return proc->getStatus();
+        }
+
         if (project->getSettings()->verboseOutput) {
             printCallStack();
         }
@@ -221,6 +267,7 @@ ProcStatus ProcDecompiler::tryDecompileRecursive(UserProc *proc)
     if (proc->getStatus() != ProcStatus::InCycle) {
         lateDecompile(proc); // Do the whole works
         proc->setStatus(ProcStatus::FinalDone);
+        proc->compact();
         project->alertEndDecompile(proc);
     }
     else if (m_recursionGroups.find(proc) != m_recursionGroups.end()) {
@@ -236,6 +283,11 @@ ProcStatus ProcDecompiler::tryDecompileRecursive(UserProc *proc)
             // Yes, process these procs as a group
             recursionGroupAnalysis(proc->getRecursionGroup());
             proc->setStatus(ProcStatus::FinalDone);
+
+            for (UserProc *groupProc : *proc->getRecursionGroup()) {
+                groupProc->compact();
+            }
+
             project->alertEndDecompile(proc);
         }
     }
@@ -342,6 +394,9 @@ void ProcDecompiler::earlyDecompile(UserProc *proc)
     project->alertStartDecompile(proc);
     project->alertDecompileDebugPoint(proc, "Before Initialize");
 
+    // Keeps the original start time when decompilation is restarted
+    m_startTimes.emplace(proc, std::chrono::steady_clock::now());
+
     PassManager::get()->executePass(PassID::StatementInit, proc);
     PassManager::get()->executePass(PassID::BBSimplify, proc); // Remove branches with false guards
     PassManager::get()->executePass(PassID::Dominators, proc);
@@ -456,6 +511,7 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
             proc->getRetStmt()
                 ->updateModifieds(); // Everything including new arguments reaching the exit
             proc->getRetStmt()->updateReturns();
+            proc->invalidateDefUseChains();
         }
 
         // Print if requested
@@ -473,24 +529,24 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
         // (* Was: mapping expressions to Parameters as we go *)
 
         // FIXME: Check if this is needed any more. At least fib seems to need it at present.
-        if (project->getSettings()->changeSignatures) {
+        if (project->getSettings()->changeSignatures && !checkBudget(proc)) {
             // addNewReturns(depth);
-            for (int i = 0; i < 3; i++) { // FIXME: should be iterate until no change
-                LOG_VERBOSE("### update returns loop iteration %1 ###", i);
-
-                if (proc->getStatus() != ProcStatus::InCycle) {
-                    PassManager::get()->executePass(PassID::BlockVarRename, proc);
-                }
+            LOG_VERBOSE("### updating returns ###");
 
-                PassManager::get()->executePass(PassID::PreservationAnalysis, proc);
+            std::vector<PassID> returnPasses;
+            if (proc->getStatus() != ProcStatus::InCycle) {
+                returnPasses.push_back(PassID::BlockVarRename);
+            }
 
-                // Returns have uses which affect call defines (if childless)
-                PassManager::get()->executePass(PassID::CallDefineUpdate, proc);
-                PassManager::get()->executePass(PassID::CallAndPhiFix, proc);
+            // Preserveds subtract from returns,
+            // and returns have uses which affect call defines (if childless).
+            // Passes are only re-run when information they depend on has changed.
+            returnPasses.push_back(PassID::PreservationAnalysis);
+            returnPasses.push_back(PassID::CallDefineUpdate);
+            returnPasses.push_back(PassID::CallAndPhiFix);
 
-                // Preserveds subtract from returns
-                PassManager::get()->executePass(PassID::PreservationAnalysis, proc);
-            }
+            PassManager::get()->executePassesToFixpoint(returnPasses, proc,
+                                                        MAX_RETURN_UPDATE_PASS_RUNS);
 
             if (project->getSettings()->verboseOutput) {
                 proc->debugPrintAll("SSA (after updating returns)");
@@ -504,6 +560,8 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
 
         project->alertDecompileDebugPoint(proc, "Before propagating statements");
 
+        // Resolve constants and constant branches first, so propagation has less to do
+        change |= PassManager::get()->executePass(PassID::SCCP, proc);
         change |= PassManager::get()->executePass(PassID::StatementPropagation, proc);
         change |= PassManager::get()->executePass(PassID::BlockVarRename, proc);
 
@@ -511,7 +569,7 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
 
         // this is just to make it readable, do NOT rely on these statements being removed
         PassManager::get()->executePass(PassID::AssignRemoval, proc);
-    } while (change && ++pass < 12);
+    } while (change && ++pass < 12 && !checkBudget(proc));
 
     // At this point, there will be some memofs that have still not been renamed. They have been
     // prevented from getting renamed so that they didn't get renamed incorrectly (usually as {-}),
@@ -544,8 +602,10 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
     bool changed = false;
     IndirectJumpAnalyzer analyzer;
 
-    for (BasicBlock *bb : *proc->getCFG()) {
-        changed |= analyzer.decodeIndirectJmp(bb, proc);
+    if (!checkBudget(proc)) {
+        for (BasicBlock *bb : *proc->getCFG()) {
+            changed |= analyzer.decodeIndirectJmp(bb, proc);
+        }
     }
 
     if (changed) {
@@ -584,7 +644,9 @@ void ProcDecompiler::middleDecompile(UserProc *proc)
         return;
     }
 
-    PassManager::get()->executePass(PassID::PreservationAnalysis, proc);
+    if (!proc->isDegraded()) {
+        PassManager::get()->executePass(PassID::PreservationAnalysis, proc);
+    }
 
     // Used to be later...
     if (project->getSettings()->nameParameters) {
@@ -683,13 +745,25 @@ void ProcDecompiler::recursionGroupAnalysis(const std::shared_ptr<ProcSet> &grou
     bool changed    = false;
     int numRepeats  = 0;
 
+    // Stop repeating the analysis as soon as any procedure of the group is over budget
+    auto isGroupDegraded = [this, &group]() {
+        bool degraded = false;
+        for (UserProc *proc : *group) {
+            degraded |= checkBudget(proc);
+        }
+
+        return degraded;
+    };
+
     do {
         ProcSet visited;
         changed = decompileProcInRecursionGroup(entry, visited);
-    } while (changed && numRepeats++ < 2);
+    } while (changed && numRepeats++ < 2 && !isGroupDegraded());
 
     // while no change
-    for (int i = 0; i < 2; i++) {
+    const int numLateRepeats = isGroupDegraded() ? 1 : 2;
+
+    for (int i = 0; i < numLateRepeats; i++) {
         for (UserProc *proc : *group) {
             lateDecompile(proc); // Also does final parameters and arguments at present
         }
@@ -758,6 +832,53 @@ void ProcDecompiler::printCallStack()
 }
 
 
+bool ProcDecompiler::checkBudget(UserProc *proc)
+{
+    if (proc->isDegraded()) {
+        return true;
+    }
+    else if (proc->getProg()->getProject()->getCancellationToken().isCancelled()) {
+        // Finish the procedure as quickly as possible
+        LOG_WARN("Decompilation cancelled; finishing procedure '%1' with a reduced pipeline",
+                 proc->getName());
+        proc->setDegraded(true);
+        return true;
+    }
+
+    const Settings *settings = proc->getProg()->getProject()->getSettings();
+    QString reason;
+
+    if (settings->procStmtBudget > 0 &&
+        proc->getCFG()->getStatements().size() > static_cast<size_t>(settings->procStmtBudget)) {
+        reason = QString("%1 statements").arg(proc->getCFG()->getStatements().size());
+    }
+
+    if (reason.isEmpty() && settings->procTimeBudget > 0) {
+        auto it = m_startTimes.find(proc);
+
+        if (it != m_startTimes.end()) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::steady_clock::now() - it->second);
+
+            if (elapsed.count() >= settings->procTimeBudget) {
+                reason = QString("%1 seconds").arg(elapsed.count());
+            }
+        }
+    }
+
+    if (reason.isEmpty()) {
+        return false;
+    }
+
+    LOG_WARN("Procedure '%1' exceeded its decompilation budget (%2); "
+             "finishing it with a reduced pipeline",
+             proc->getName(), reason);
+
+    proc->setDegraded(true);
+    return true;
+}
+
+
 void ProcDecompiler::saveDecodedICTs(UserProc *proc)
 {
     for (BasicBlock *bb : *proc->getCFG()) {
@@ -12,6 +12,7 @@
 
 #include "boomerang/db/proc/UserProc.h"
 
+#include <chrono>
 #include <unordered_map>
 
 
@@ -23,6 +24,18 @@ public:
 public:
     void decompileRecursive(UserProc *proc);
 
+    /**
+     * Decompile \p proc without decompiling its callees first.
+     * Calls to callees that are not decompiled yet are summarized by the signature
+     * of the callee if it is forced, or treated as childless calls that use and define
+     * all locations otherwise.
+     * Use getSummarizedCallees() to get the callees that were summarized.
+     */
+    void decompileSingle(UserProc *proc);
+
+    /// \returns the callees summarized by decompileSingle(), in the order they were found.
+    const ProcList &getSummarizedCallees() const { return m_summarizedCallees; }
+
 private:
     ProcStatus tryDecompileRecursive(UserProc *proc);
 
@@ -52,6 +65,15 @@ private:
 
     void printCallStack();
 
+    /**
+     * Check if \p proc has exceeded its decompilation budget (time or number of statements),
+     * or if decompilation was cancelled.
+     * If so, \p proc is marked as degraded, and the remaining decompilation of \p proc
+     * skips expensive analyses (preservation proofs, switch analysis, type analysis).
+     * \returns true if \p proc is degraded.
+     */
+    bool checkBudget(UserProc *proc);
+
     /**
      * Copy the RTLs for the already decoded Indirect Control Transfer instructions,
      * and decode any new targets in this CFG.
@@ -65,6 +87,10 @@ private:
 private:
     ProcList m_callStack;
 
+    /// If true, callees that are not decompiled yet are summarized instead of decompiled.
+    bool m_summarizeCallees = false;
+    ProcList m_summarizedCallees;
+
     /**
      * Pointer to a set of procedures involved in a recursion group.
      * The procedures in the ProcSet form a strongly connected component of the call graph.
@@ -74,4 +100,7 @@ private:
      * each procedure is part of at most 1 recursion group.
      */
     std::unordered_map<UserProc *, std::shared_ptr<ProcSet>> m_recursionGroups;
+
+    /// Time when decompilation of each procedure started, for the decompilation time budget.
+    std::unordered_map<UserProc *, std::chrono::steady_clock::time_point> m_startTimes;
 };
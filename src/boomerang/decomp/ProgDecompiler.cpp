@@ -22,6 +22,8 @@
 #include "boomerang/ssl/exp/Location.h"
 #include "boomerang/util/log/Log.h"
 
+#include <QStringList>
+
 
 ProgDecompiler::ProgDecompiler(Prog *prog)
     : m_prog(prog)
@@ -34,8 +36,14 @@ void ProgDecompiler::decompile()
     assert(!m_prog->getModuleList().empty());
     LOG_VERBOSE("%1 procedures", m_prog->getNumFunctions(false));
 
+    const CancellationToken &cancellation = m_prog->getProject()->getCancellationToken();
+
     // Start decompiling each entry point
     for (UserProc *up : m_prog->getEntryProcs()) {
+        if (cancellation.isCancelled()) {
+            break;
+        }
+
         LOG_MSG("Decompiling entry point '%1'", up->getName());
         up->decompileRecursive();
     }
@@ -46,7 +54,7 @@ void ProgDecompiler::decompile()
         m_prog->getProject()->getSettings()->decodeChildren) {
         bool foundone = true;
 
-        while (foundone) {
+        while (foundone && !cancellation.isCancelled()) {
             foundone = false;
 
             for (const auto &module : m_prog->getModuleList()) {
@@ -67,6 +75,12 @@ void ProgDecompiler::decompile()
         }
     }
 
+    if (cancellation.isCancelled()) {
+        // Only make the completely decompiled procedures ready for code generation
+        finishCancelledDecompilation();
+        return;
+    }
+
     globalTypeAnalysis();
 
     if (m_prog->getProject()->getSettings()->removeReturns) {
@@ -101,6 +115,7 @@ void ProgDecompiler::decompile()
         }
     }
 
+    reportDegradedProcs();
     LOG_MSG("Decompilation finished.");
 }
 
@@ -151,11 +166,7 @@ void ProgDecompiler::removeUnusedGlobals()
             Location search(opGlobal, Terminal::get(opWild), proc);
             // Search each statement in u, excepting implicit assignments (their uses don't count,
             // since they don't really exist in the program representation)
-            StatementList stmts;
-            StatementList::iterator ss;
-            proc->getStatements(stmts);
-
-            for (Statement *s : stmts) {
+            for (Statement *s : proc->getCFG()->getStatements()) {
                 if (s->isImplicit()) {
                     continue; // Ignore the uses in ImplicitAssigns
                 }
@@ -198,6 +209,65 @@ void ProgDecompiler::removeUnusedGlobals()
 }
 
 
+void ProgDecompiler::finishCancelledDecompilation()
+{
+    int numDecompiled = 0;
+    int numProcs      = 0;
+
+    LOG_MSG("Transforming from SSA form...");
+
+    for (const auto &module : m_prog->getModuleList()) {
+        for (Function *func : *module) {
+            if (func->isLib()) {
+                continue;
+            }
+
+            UserProc *proc = static_cast<UserProc *>(func);
+            numProcs++;
+
+            if (!proc->isDecompiled()) {
+                continue;
+            }
+
+            numDecompiled++;
+            proc->numberStatements();
+            PassManager::get()->executePass(PassID::FromSSAForm, proc);
+            CFGCompressor().compressCFG(proc->getCFG());
+        }
+    }
+
+    reportDegradedProcs();
+    LOG_WARN("Decompilation cancelled. %1 of %2 procedures were decompiled completely.",
+             numDecompiled, numProcs);
+}
+
+
+void ProgDecompiler::reportDegradedProcs()
+{
+    QStringList degradedProcs;
+
+    for (const auto &module : m_prog->getModuleList()) {
+        for (Function *func : *module) {
+            if (!func->isLib() && static_cast<UserProc *>(func)->isDegraded()) {
+                degradedProcs.append(func->getName());
+            }
+        }
+    }
+
+    if (degradedProcs.isEmpty()) {
+        return;
+    }
+
+    LOG_WARN("%1 procedures exceeded their decompilation budget "
+             "and were decompiled with a reduced pipeline:",
+             degradedProcs.size());
+
+    for (const QString &name : degradedProcs) {
+        LOG_WARN("    %1", name);
+    }
+}
+
+
 bool ProgDecompiler::removeUnusedParamsAndReturns()
 {
     LOG_MSG("Removing unused returns...");
@@ -33,6 +33,13 @@ private:
     /// As the name suggests, removes globals unused in the decompiled code.
     void removeUnusedGlobals();
 
+    /// Log all procedures that exceeded their decompilation budget.
+    void reportDegradedProcs();
+
+    /// Skip all global analyses after decompilation was cancelled,
+    /// and only transform procedures that were decompiled completely out of SSA form.
+    void finishCancelledDecompilation();
+
     /// Remove unused or redundant parameters and return values from the program.
     /// \returns true if any change
     bool removeUnusedParamsAndReturns();
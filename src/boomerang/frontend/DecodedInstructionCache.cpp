@@ -0,0 +1,91 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DecodedInstructionCache.h"
+
+#include "boomerang/ssl/RTL.h"
+
+
+DecodedInstructionCache::DecodedInstructionCache(std::size_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+
+DecodedInstructionCache::~DecodedInstructionCache()
+{
+}
+
+
+bool DecodedInstructionCache::lookup(Address pc, DecodeResult &result)
+{
+    auto it = m_entries.find(pc.value());
+    if (it == m_entries.end()) {
+        m_numMisses++;
+        return false;
+    }
+
+    const Entry &entry = it->second;
+
+    result.reset();
+    result.rtl.reset(new RTL(*entry.rtl));
+    result.type         = entry.type;
+    result.numBytes     = entry.numBytes;
+    result.forceOutEdge = entry.forceOutEdge;
+
+    m_numHits++;
+    return true;
+}
+
+
+void DecodedInstructionCache::insert(Address pc, const DecodeResult &result)
+{
+    if (m_capacity == 0 || !result.valid || !result.rtl) {
+        return;
+    }
+    else if (result.reDecode) {
+        // The decoder returns a different result each time the instruction is decoded.
+        m_uncacheable.insert(pc.value());
+
+        auto it = m_entries.find(pc.value());
+        if (it != m_entries.end()) {
+            m_insertionOrder.erase(it->second.insertionPos);
+            m_entries.erase(it);
+        }
+
+        return;
+    }
+    else if (m_uncacheable.find(pc.value()) != m_uncacheable.end() ||
+             m_entries.find(pc.value()) != m_entries.end()) {
+        return;
+    }
+
+    while (m_entries.size() >= m_capacity) {
+        m_entries.erase(m_insertionOrder.front());
+        m_insertionOrder.pop_front();
+    }
+
+    Entry &entry       = m_entries[pc.value()];
+    entry.rtl          = std::make_unique<const RTL>(*result.rtl);
+    entry.type         = result.type;
+    entry.numBytes     = result.numBytes;
+    entry.forceOutEdge = result.forceOutEdge;
+    entry.insertionPos = m_insertionOrder.insert(m_insertionOrder.end(), pc.value());
+}
+
+
+void DecodedInstructionCache::clear()
+{
+    m_entries.clear();
+    m_insertionOrder.clear();
+    m_uncacheable.clear();
+
+    m_numHits   = 0;
+    m_numMisses = 0;
+}
@@ -0,0 +1,96 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/frontend/DecodeResult.h"
+#include "boomerang/util/Address.h"
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+
+/**
+ * Caches the results of decoding single instructions by address, so instructions
+ * that are decoded more than once (e.g. when a procedure is re-decoded, or the delay slot
+ * instructions of SPARC branches) are only decoded once.
+ *
+ * The cache holds at most a fixed number of instructions. When it is full,
+ * the instructions that were inserted first are evicted first.
+ */
+class BOOMERANG_API DecodedInstructionCache
+{
+public:
+    /// Default maximum number of cached instructions
+    static constexpr std::size_t DEFAULT_CAPACITY = 1 << 15;
+
+public:
+    explicit DecodedInstructionCache(std::size_t capacity = DEFAULT_CAPACITY);
+    DecodedInstructionCache(const DecodedInstructionCache &other) = delete;
+    DecodedInstructionCache(DecodedInstructionCache &&other)      = default;
+
+    ~DecodedInstructionCache();
+
+    DecodedInstructionCache &operator=(const DecodedInstructionCache &other) = delete;
+    DecodedInstructionCache &operator=(DecodedInstructionCache &&other) = default;
+
+public:
+    /**
+     * Look up the instruction at address \p pc.
+     * \param pc     address of the instruction
+     * \param result If the instruction is cached, set to a copy of the cached decode result.
+     *               The RTL of the result is a deep copy of the cached RTL.
+     * \returns true if the instruction is cached.
+     */
+    bool lookup(Address pc, DecodeResult &result);
+
+    /**
+     * Store a copy of the decode result \p result of the instruction at address \p pc.
+     * Invalid results and results of instructions that have to be decoded multiple times
+     * (see DecodeResult::reDecode) are not cached.
+     */
+    void insert(Address pc, const DecodeResult &result);
+
+    /// Remove all instructions from the cache and reset the statistics.
+    void clear();
+
+    std::size_t size() const { return m_entries.size(); }
+    std::size_t getCapacity() const { return m_capacity; }
+
+    std::size_t getNumHits() const { return m_numHits; }
+    std::size_t getNumMisses() const { return m_numMisses; }
+
+private:
+    struct Entry
+    {
+        std::unique_ptr<const RTL> rtl;
+        ICLASS type;
+        int numBytes;
+        Address forceOutEdge;
+        std::list<Address::value_type>::iterator insertionPos; ///< position in m_insertionOrder
+    };
+
+private:
+    std::size_t m_capacity;
+
+    std::unordered_map<Address::value_type, Entry> m_entries;
+
+    /// Addresses of the cached instructions, in insertion order
+    std::list<Address::value_type> m_insertionOrder;
+
+    /// Addresses of instructions that must be decoded multiple times
+    std::unordered_set<Address::value_type> m_uncacheable;
+
+    std::size_t m_numHits   = 0;
+    std::size_t m_numMisses = 0;
+};
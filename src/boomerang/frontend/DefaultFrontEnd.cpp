@@ -52,6 +52,12 @@ bool DefaultFrontEnd::initialize(Project *project)
     m_program    = project->getProg();
     m_binaryFile = project->getLoadedBinaryFile();
 
+    // The frontend outlives the program it was last initialized for
+    // (e.g. when loading another binary), so forget everything about the old program.
+    m_refHints.clear();
+    m_previouslyDecoded.clear();
+    m_decodedInstructions.clear();
+
     if (!m_decoder) {
         return false;
     }
@@ -81,7 +87,11 @@ bool DefaultFrontEnd::decodeEntryPointsRecursive(bool decodeMain)
         std::vector<Address> entrypoints = findEntryPoints();
 
         for (auto &entrypoint : entrypoints) {
-            if (!decodeRecursive(entrypoint)) {
+            if (m_program->getProject()->getCancellationToken().isCancelled()) {
+                LOG_WARN("Decoding cancelled, not decoding remaining entry points");
+                break;
+            }
+            else if (!decodeRecursive(entrypoint)) {
                 return false;
             }
         }
@@ -182,6 +192,10 @@ bool DefaultFrontEnd::decodeUndecoded()
                 if (userProc->isDecoded()) {
                     continue;
                 }
+                else if (m_program->getProject()->getCancellationToken().isCancelled()) {
+                    LOG_WARN("Decoding cancelled, not decoding remaining procedures");
+                    return m_program->isWellFormed();
+                }
 
                 // undecoded userproc.. decode it
                 change = true;
@@ -742,6 +756,8 @@ bool DefaultFrontEnd::processProc(UserProc *proc, Address addr)
     m_program->getProject()->alertFunctionDecoded(proc, startAddr, lastAddr, numBytesDecoded);
 
     LOG_VERBOSE("### Finished decoding proc '%1' ###", proc->getName());
+    LOG_VERBOSE("Decoded instruction cache: %1 hits, %2 misses",
+                m_decodedInstructions.getNumHits(), m_decodedInstructions.getNumMisses());
 
     return true;
 }
@@ -749,6 +765,28 @@ bool DefaultFrontEnd::processProc(UserProc *proc, Address addr)
 
 bool DefaultFrontEnd::decodeSingleInstruction(Address pc, DecodeResult &result)
 {
+    if (m_decodedInstructions.lookup(pc, result)) {
+        // The decoder binds calls to their destinations, which is not part of the cached RTL.
+        for (Statement *stmt : *result.rtl) {
+            if (!stmt->isCall()) {
+                continue;
+            }
+
+            CallStatement *call = static_cast<CallStatement *>(stmt);
+            if (!call->isComputed() && call->getDest()->isConst()) {
+                Function *destProc = m_program->getOrCreateFunction(call->getFixedDest());
+
+                if (destProc == reinterpret_cast<Function *>(-1)) {
+                    destProc = nullptr; // In case a deleted Proc
+                }
+
+                call->setDestProc(destProc);
+            }
+        }
+
+        return true;
+    }
+
     BinaryImage *image = m_program->getBinaryFile()->getImage();
     if (!image || (image->getSectionByAddr(pc) == nullptr)) {
         LOG_ERROR("Attempted to decode outside any known section at address %1", pc);
@@ -766,7 +804,12 @@ bool DefaultFrontEnd::decodeSingleInstruction(Address pc, DecodeResult &result)
     ptrdiff_t host_native_diff = (section->getHostAddr() - section->getSourceAddr()).value();
 
     try {
-        return m_decoder->decodeInstruction(pc, host_native_diff, result);
+        const bool ok = m_decoder->decodeInstruction(pc, host_native_diff, result);
+        if (ok) {
+            m_decodedInstructions.insert(pc, result);
+        }
+
+        return ok;
     }
     catch (std::runtime_error &e) {
         LOG_ERROR("%1", e.what());
@@ -1001,6 +1044,7 @@ void DefaultFrontEnd::preprocessProcGoto(std::list<Statement *>::iterator ss, Ad
         assert(!originalRTL->empty());
         originalRTL->back() = call;
         *ss                 = call;
+        originalRTL->markModified();
     }
 }
 
@@ -10,6 +10,7 @@
 #pragma once
 
 
+#include "boomerang/frontend/DecodedInstructionCache.h"
 #include "boomerang/frontend/SigEnum.h"
 #include "boomerang/frontend/TargetQueue.h"
 #include "boomerang/ifc/IFrontEnd.h"
@@ -159,4 +160,7 @@ protected:
     /// Map from address to previously decoded RTLs for decoded indirect control transfer
     /// instructions
     std::map<Address, RTL *> m_previouslyDecoded;
+
+    /// Results of all recently decoded instructions, so they are not decoded again
+    DecodedInstructionCache m_decodedInstructions;
 };
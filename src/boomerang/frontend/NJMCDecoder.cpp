@@ -42,7 +42,7 @@ NJMCDecoder::NJMCDecoder(Project *project, const QString &sslFileName)
         realSSLFileName = settings->getDataDirectory().absoluteFilePath(sslFileName);
     }
 
-    if (!m_rtlDict.readSSLFile(realSSLFileName)) {
+    if (!readSSLFile(realSSLFileName)) {
         LOG_ERROR("Cannot read SSL file '%1'", realSSLFileName);
         throw std::runtime_error("Cannot read SSL file");
     }
@@ -59,10 +59,8 @@ bool NJMCDecoder::initialize(Project *project)
 std::unique_ptr<RTL> NJMCDecoder::instantiate(Address pc, const char *name,
                                               const std::initializer_list<SharedExp> &args)
 {
-    // Get the signature of the instruction and extract its parts
-    std::pair<QString, int> sig = m_rtlDict.getSignature(name);
-    QString opcode              = sig.first;
-    int numOperands             = sig.second;
+    const int handle      = getInstructionHandle(name);
+    const int numOperands = (handle != -1) ? m_rtlDict.getNumParams(handle) : -1;
 
     if (numOperands == -1) {
         LOG_ERROR("Could not find semantics for instruction '%1', treating instruction as NOP",
@@ -107,7 +105,28 @@ std::unique_ptr<RTL> NJMCDecoder::instantiate(Address pc, const char *name,
         q_cout << '\n';
     }
 
-    return m_rtlDict.instantiateRTL(opcode, pc, actuals);
+    return m_rtlDict.instantiateRTL(handle, pc, actuals);
+}
+
+
+bool NJMCDecoder::readSSLFile(const QString &sslFileName)
+{
+    // Handles are positions in the dictionary, so they change with the SSL file
+    m_instructionHandles.clear();
+    return m_rtlDict.readSSLFile(sslFileName);
+}
+
+
+int NJMCDecoder::getInstructionHandle(const char *name)
+{
+    auto it = m_instructionHandles.find(name);
+    if (it != m_instructionHandles.end() && it->second.name == name) {
+        return it->second.handle;
+    }
+
+    const int handle           = m_rtlDict.getInstructionHandle(name);
+    m_instructionHandles[name] = { name, handle };
+    return handle;
 }
 
 
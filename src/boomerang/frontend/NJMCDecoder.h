@@ -15,6 +15,9 @@
 #include "boomerang/ssl/exp/ExpHelp.h"
 #include "boomerang/util/Util.h"
 
+#include <string>
+#include <unordered_map>
+
 
 class BinaryImage;
 
@@ -98,6 +101,17 @@ protected:
     std::unique_ptr<RTL> instantiate(Address pc, const char *name,
                                      const std::initializer_list<SharedExp> &args = {});
 
+    /// Read the instruction semantics from \p sslFileName into the RTL dictionary,
+    /// replacing all previously read semantics.
+    /// \returns true on success
+    bool readSSLFile(const QString &sslFileName);
+
+    /// \returns the handle of the instruction with name \p name in the RTL dictionary,
+    /// or -1 if the instruction does not exist. The names passed by the generated decoders
+    /// are string literals, so the handles are cached by the address of the name instead of
+    /// hashing its contents. Each name is only looked up in the dictionary once.
+    int getInstructionHandle(const char *name);
+
     /**
      * Process an unconditional jump instruction
      * Also check if the destination is a label (MVE: is this done?)
@@ -131,6 +145,16 @@ protected:
     RTLInstDict m_rtlDict;
     Prog *m_prog         = nullptr;
     BinaryImage *m_image = nullptr;
+
+    struct InstructionHandle
+    {
+        std::string name; ///< to detect a different name at the same address
+        int handle;
+    };
+
+    /// Handles of all instructions decoded so far, by address of the instruction name.
+    /// Only valid for the SSL file currently loaded into \ref m_rtlDict.
+    std::unordered_map<const char *, InstructionHandle> m_instructionHandles;
 };
 
 
@@ -83,6 +83,13 @@ public:
         return false;
     }
 
+    /// \returns the relocation at address \p addr, or nullptr if there is no relocation.
+    virtual const BinaryRelocation *getRelocationAt(Address addr) const
+    {
+        Q_UNUSED(addr);
+        return nullptr;
+    }
+
     /// \returns the target of the jmp/jXX instruction at address \p addr.
     /// If there is no jump at address \p addr, returns Address::INVALID.
     virtual Address getJumpTarget(Address addr) const
@@ -12,6 +12,9 @@
 
 #include <QString>
 
+#include <bitset>
+#include <initializer_list>
+
 
 class UserProc;
 
@@ -45,10 +48,37 @@ enum class PassID
     UnusedParamRemoval,
     ImplicitPlacement,
     LocalAndParamMap,
+    SCCP,
     NUM_PASSES
 };
 
 
+/// Information about a procedure that passes depend on and may invalidate.
+enum class PassFact
+{
+    Dominators = 0, ///< Dominator tree and dominance frontiers
+    SSANames,       ///< Placement of phi functions and subscripts of locations
+    Statements,     ///< Expressions in statements (e.g. changed by propagation or bypassing)
+    CallDefines,    ///< Locations defined by calls and returned by the return statement
+    Preservations,  ///< Locations proven to be preserved by the procedure
+    NUM_FACTS
+};
+
+typedef std::bitset<static_cast<size_t>(PassFact::NUM_FACTS)> PassFacts;
+
+
+/// \returns a set containing all facts in \p facts
+inline PassFacts makePassFacts(std::initializer_list<PassFact> facts)
+{
+    PassFacts result;
+    for (PassFact fact : facts) {
+        result.set(static_cast<size_t>(fact));
+    }
+
+    return result;
+}
+
+
 /// Passes run during the decompilation process
 /// and update statements in a UserProc.
 class IPass
@@ -65,6 +95,18 @@ public:
     /// This means that procLocal passes can be executed for each function in parallel.
     virtual bool isProcLocal() const { return false; }
 
+    /// \returns the information about the procedure this pass depends on.
+    /// When iterating to a fixpoint, the pass is only re-run if any of it was invalidated.
+    virtual PassFacts getInputs() const { return PassFacts().set(); }
+
+    /// \returns the information about the procedure that may be invalidated
+    /// when this pass reports a change.
+    virtual PassFacts getOutputs() const { return PassFacts().set(); }
+
+    /// \returns true iff the pass keeps the def-use chains of the procedure up to date.
+    /// The chains are discarded after running any other pass. \sa UserProc::getDefUseChains
+    virtual bool preservesDefUseChains() const { return false; }
+
     /// Run this pass, updating \p proc
     /// \returns true iff any change
     virtual bool execute(UserProc *proc) = 0;
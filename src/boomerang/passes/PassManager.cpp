@@ -36,6 +36,7 @@
 #include "boomerang/passes/middle/DuplicateArgsRemovalPass.h"
 #include "boomerang/passes/middle/ParameterSymbolMapPass.h"
 #include "boomerang/passes/middle/PreservationAnalysisPass.h"
+#include "boomerang/passes/middle/SCCPPass.h"
 #include "boomerang/passes/middle/SPPreservationPass.h"
 #include "boomerang/passes/middle/StrengthReductionReversalPass.h"
 #include "boomerang/util/Util.h"
@@ -78,6 +79,7 @@ PassManager::PassManager()
     registerPass(PassID::UnusedParamRemoval, std::make_unique<UnusedParamRemovalPass>());
     registerPass(PassID::ImplicitPlacement, std::make_unique<ImplicitPlacementPass>());
     registerPass(PassID::LocalAndParamMap, std::make_unique<LocalAndParamMapPass>());
+    registerPass(PassID::SCCP, std::make_unique<SCCPPass>());
 
     for (auto &pass : m_passes) {
         Q_UNUSED(pass);
@@ -125,6 +127,10 @@ bool PassManager::executePass(IPass *pass, UserProc *proc)
 
     const bool changed = pass->execute(proc);
 
+    if (!pass->preservesDefUseChains()) {
+        proc->invalidateDefUseChains();
+    }
+
     QString msg = QString("after executing pass '%1'").arg(pass->getName());
     proc->debugPrintAll(qPrintable(msg));
     proc->getProg()->getProject()->alertDecompileDebugPoint(proc, qPrintable(msg));
@@ -153,6 +159,100 @@ bool PassManager::executePassGroup(const QString &name, UserProc *proc)
 }
 
 
+bool PassManager::executePassesToFixpoint(const std::vector<PassID> &passIDs, UserProc *proc,
+                                          int maxPassRuns)
+{
+    std::vector<IPass *> passes;
+    for (PassID passID : passIDs) {
+        passes.push_back(getPass(passID));
+    }
+
+    return executePassesToFixpoint(passes, proc, maxPassRuns);
+}
+
+
+bool PassManager::executePassesToFixpoint(const std::vector<IPass *> &passes, UserProc *proc,
+                                          int maxPassRuns)
+{
+    const size_t numFacts = static_cast<size_t>(PassFact::NUM_FACTS);
+
+    // Executions are numbered; a pass needs to be re-run if one of its inputs
+    // was invalidated by an execution later than its own last execution.
+    std::vector<int> lastRun(passes.size(), -1);
+    std::vector<int> invalidatedAt(numFacts, -1);
+    std::vector<int> numRuns(passes.size(), 0);
+
+    int currentRun = 0;
+    bool changed   = false;
+    bool ranAny    = true;
+
+    while (ranAny) {
+        ranAny = false;
+
+        for (size_t i = 0; i < passes.size(); i++) {
+            IPass *pass = passes[i];
+            assert(pass != nullptr);
+
+            if (lastRun[i] >= 0) {
+                const PassFacts inputs = pass->getInputs();
+                bool inputChanged      = false;
+
+                for (size_t fact = 0; fact < numFacts; fact++) {
+                    if (inputs.test(fact) && invalidatedAt[fact] > lastRun[i]) {
+                        inputChanged = true;
+                        break;
+                    }
+                }
+
+                if (!inputChanged) {
+                    continue;
+                }
+            }
+
+            if (proc->getProg()->getProject()->getCancellationToken().isCancelled()) {
+                // Stop early, like when exceeding the budget
+                LOG_VERBOSE("Decompilation cancelled before reaching a fixpoint for '%1'",
+                            proc->getName());
+                return changed;
+            }
+            else if (currentRun >= maxPassRuns) {
+                QString runs;
+                for (size_t j = 0; j < passes.size(); j++) {
+                    runs += QString("%1%2: %3")
+                                .arg(j > 0 ? ", " : "")
+                                .arg(passes[j]->getName())
+                                .arg(numRuns[j]);
+                }
+
+                LOG_WARN("Budget of %1 pass executions exceeded for '%2' before reaching a fixpoint "
+                         "(%3)",
+                         maxPassRuns, proc->getName(), runs);
+                return changed;
+            }
+
+            lastRun[i] = currentRun;
+            numRuns[i]++;
+            ranAny = true;
+
+            if (executePass(pass, proc)) {
+                changed                 = true;
+                const PassFacts outputs = pass->getOutputs();
+
+                for (size_t fact = 0; fact < numFacts; fact++) {
+                    if (outputs.test(fact)) {
+                        invalidatedAt[fact] = currentRun;
+                    }
+                }
+            }
+
+            currentRun++;
+        }
+    }
+
+    return changed;
+}
+
+
 void PassManager::registerPass(PassID passID, std::unique_ptr<IPass> pass)
 {
     assert(Util::inRange(static_cast<size_t>(passID), static_cast<size_t>(0), m_passes.size()));
@@ -17,6 +17,7 @@
 #include <QMap>
 
 #include <memory>
+#include <vector>
 
 
 class Prog;
@@ -53,6 +54,21 @@ public:
     /// \returns true iff at least 1 pass updated \p proc
     bool executePassGroup(const QString &name, UserProc *proc);
 
+    /**
+     * Execute \p passes in order repeatedly until none of them changes \p proc any more.
+     * After the first round, a pass is only re-run if any of its inputs was invalidated
+     * by another pass since the pass was last executed.
+     *
+     * \param maxPassRuns Work budget, i.e. the maximum number of pass executions.
+     * If the fixpoint is not reached within the budget, a warning is logged.
+     * Iteration also stops early when decompilation is cancelled.
+     * \returns true iff at least 1 pass updated \p proc
+     */
+    bool executePassesToFixpoint(const std::vector<PassID> &passes, UserProc *proc,
+                                 int maxPassRuns);
+    bool executePassesToFixpoint(const std::vector<IPass *> &passes, UserProc *proc,
+                                 int maxPassRuns);
+
 private:
     void registerPass(PassID passType, std::unique_ptr<IPass> pass);
 
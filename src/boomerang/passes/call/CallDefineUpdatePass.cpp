@@ -20,6 +20,42 @@
 #include "boomerang/util/StatementList.h"
 #include "boomerang/util/log/Log.h"
 
+#include <vector>
+
+
+/// \returns the locations defined by \p defines, in order
+static std::vector<SharedExp> getDefinedLocs(const StatementList &defines)
+{
+    std::vector<SharedExp> locs;
+    locs.reserve(defines.size());
+
+    for (const Statement *def : defines) {
+        locs.push_back(static_cast<const Assignment *>(def)->getLeft());
+    }
+
+    return locs;
+}
+
+
+/// \returns true if \p defines do not define exactly the locations in \p oldLocs (in order)
+static bool definesChanged(const std::vector<SharedExp> &oldLocs, const StatementList &defines)
+{
+    if (oldLocs.size() != defines.size()) {
+        return true;
+    }
+
+    auto locIt = oldLocs.begin();
+    for (const Statement *def : defines) {
+        if (!(**locIt == *static_cast<const Assignment *>(def)->getLeft())) {
+            return true;
+        }
+
+        ++locIt;
+    }
+
+    return false;
+}
+
 
 CallDefineUpdatePass::CallDefineUpdatePass()
     : IPass("CallDefineUpdate", PassID::CallDefineUpdate)
@@ -27,6 +63,18 @@ CallDefineUpdatePass::CallDefineUpdatePass()
 }
 
 
+PassFacts CallDefineUpdatePass::getInputs() const
+{
+    return makePassFacts({ PassFact::SSANames, PassFact::CallDefines, PassFact::Preservations });
+}
+
+
+PassFacts CallDefineUpdatePass::getOutputs() const
+{
+    return makePassFacts({ PassFact::CallDefines });
+}
+
+
 bool CallDefineUpdatePass::execute(UserProc *proc)
 {
     StatementList stmts;
@@ -54,16 +102,18 @@ bool CallDefineUpdatePass::updateCallDefines(UserProc *proc, CallStatement *call
 
     std::shared_ptr<Signature> sig = callee ? callee->getSignature() : proc->getSignature();
 
+    const std::vector<SharedExp> oldLocs = getDefinedLocs(callStmt->getDefines());
+
     if (callee && callee->isLib()) {
         StatementList defines;
         sig->getLibraryDefines(defines); // Set the locations defined
         callStmt->setDefines(defines);
-        return true;
+        return definesChanged(oldLocs, callStmt->getDefines());
     }
     else if (proc->getProg()->getProject()->getSettings()->assumeABI) {
         // Risky: just assume the ABI caller save registers are defined
         Signature::getABIDefines(proc->getProg()->getMachine(), callStmt->getDefines());
-        return true;
+        return definesChanged(oldLocs, callStmt->getDefines());
     }
 
     // Move the defines to a temporary list. We must make sure that all defines
@@ -150,5 +200,5 @@ bool CallDefineUpdatePass::updateCallDefines(UserProc *proc, CallStatement *call
         }
     }
 
-    return true;
+    return definesChanged(oldLocs, callStmt->getDefines());
 }
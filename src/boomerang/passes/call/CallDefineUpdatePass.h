@@ -24,6 +24,12 @@ public:
     CallDefineUpdatePass();
 
 public:
+    /// \copydoc IPass::getInputs
+    PassFacts getInputs() const override;
+
+    /// \copydoc IPass::getOutputs
+    PassFacts getOutputs() const override;
+
     /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
 
@@ -252,7 +252,7 @@ bool BlockVarRenamePass::renameBlockVars(
 
     for (int X = 0; X < numBB; X++) {
         if (proc->getDataFlow()->getIdom(X) == n) { // if 'n' is immediate dominator of X
-            renameBlockVars(proc, X, stacks);
+            changed |= renameBlockVars(proc, X, stacks);
         }
     }
 
@@ -296,6 +296,19 @@ bool BlockVarRenamePass::renameBlockVars(
 }
 
 
+PassFacts BlockVarRenamePass::getInputs() const
+{
+    return makePassFacts({ PassFact::Dominators, PassFact::SSANames, PassFact::Statements,
+                           PassFact::CallDefines });
+}
+
+
+PassFacts BlockVarRenamePass::getOutputs() const
+{
+    return makePassFacts({ PassFact::SSANames });
+}
+
+
 bool BlockVarRenamePass::execute(UserProc *proc)
 {
     /// The stack which remembers the last definition of an expression.
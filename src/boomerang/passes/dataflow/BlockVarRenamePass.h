@@ -27,6 +27,12 @@ public:
     BlockVarRenamePass();
 
 public:
+    /// \copydoc IPass::getInputs
+    PassFacts getInputs() const override;
+
+    /// \copydoc IPass::getOutputs
+    PassFacts getOutputs() const override;
+
     /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
 
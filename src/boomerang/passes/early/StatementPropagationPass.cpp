@@ -10,14 +10,14 @@
 #include "StatementPropagationPass.h"
 
 #include "boomerang/core/Project.h"
+#include "boomerang/db/DefUseChains.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/passes/PassManager.h"
 #include "boomerang/ssl/exp/Location.h"
 #include "boomerang/ssl/statements/PhiAssign.h"
+#include "boomerang/util/StatementSet.h"
 #include "boomerang/util/log/Log.h"
-#include "boomerang/visitor/expvisitor/ExpDestCounter.h"
-#include "boomerang/visitor/stmtexpvisitor/StmtDestCounter.h"
 
 
 StatementPropagationPass::StatementPropagationPass()
@@ -35,24 +35,19 @@ bool StatementPropagationPass::execute(UserProc *proc)
     LocationSet usedByDomPhi;
     findLiveAtDomPhi(proc, usedByDomPhi);
 
-    // Next pass: count the number of times each assignment LHS would be propagated somewhere
-    std::map<SharedExp, int, lessExpStar> destCounts;
-
-    // Also maintain a set of locations which are used by phi statements
-    for (Statement *s : stmts) {
-        ExpDestCounter edc(destCounts);
-        StmtDestCounter sdc(&edc);
-        s->accept(&sdc);
-    }
+    // The number of times each assignment LHS would be propagated somewhere.
+    // The counts are those before propagation; the chains of the changed statements
+    // are only updated when all statements have been propagated into.
+    DefUseChains &defUses                         = proc->getDefUseChains();
+    const ExpDestCounter::ExpCountMap &destCounts = defUses.getDestCounts();
+    StatementSet changedStmts;
 
     // A fourth pass to propagate only the flags (these must be propagated even if it results in
     // extra locals)
-    bool change = false;
-
     Settings *settings = proc->getProg()->getProject()->getSettings();
     for (Statement *s : stmts) {
-        if (!s->isPhi()) {
-            change |= s->propagateFlagsTo(settings);
+        if (!s->isPhi() && s->propagateFlagsTo(settings)) {
+            changedStmts.insert(s);
         }
     }
 
@@ -60,14 +55,24 @@ bool StatementPropagationPass::execute(UserProc *proc)
     bool convert = false;
 
     for (Statement *s : stmts) {
-        if (!s->isPhi()) {
-            change |= s->propagateTo(convert, settings, &destCounts, &usedByDomPhi);
+        if (!s->isPhi() && s->propagateTo(convert, settings, &destCounts, &usedByDomPhi)) {
+            changedStmts.insert(s);
+        }
+    }
+
+    if (convert) {
+        // An indirect call was converted to a direct call
+        proc->invalidateDefUseChains();
+    }
+    else {
+        for (Statement *s : changedStmts) {
+            defUses.updateStatement(s);
         }
     }
 
     propagateToCollector(&proc->getUseCollector());
 
-    return change || convert;
+    return !changedStmts.empty() || convert;
 }
 
 
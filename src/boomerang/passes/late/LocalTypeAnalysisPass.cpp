@@ -38,7 +38,8 @@ bool LocalTypeAnalysisPass::execute(UserProc *proc)
 
     // Data flow based type analysis
     // Want to be after all propagation, but before converting expressions to locals etc
-    if (rec && project->getSettings()->useTypeAnalysis) {
+    // Skipped for procedures that exceeded their decompilation budget.
+    if (rec && project->getSettings()->useTypeAnalysis && !proc->isDegraded()) {
         rec->recoverFunctionTypes(proc);
         return true;
     }
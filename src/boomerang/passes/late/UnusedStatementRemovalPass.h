@@ -12,30 +12,34 @@
 
 #include "boomerang/passes/Pass.h"
 
-#include <map>
-
 
+class DefUseChains;
 class Statement;
 
 
 /// Remove unused statements
 class UnusedStatementRemovalPass final : public IPass
 {
-    typedef std::map<Statement *, int> RefCounter;
-
 public:
     UnusedStatementRemovalPass();
 
 public:
+    /// \copydoc IPass::preservesDefUseChains
+    bool preservesDefUseChains() const override { return true; }
+
     /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
 
 private:
-    /// Count references to the things that are under SSA control.
-    /// For each SSA subscripting, increment a counter for that definition
-    void updateRefCounts(UserProc *proc, RefCounter &refCounts);
+    /// Print the number of uses of all definitions that are used (for debugging).
+    void printUseCounts(UserProc *proc, const DefUseChains &defUses);
+
+    /// Remove all statements that are not used, and all statements that are only
+    /// used by removed statements.
+    void remUnusedStmtEtc(UserProc *proc, DefUseChains &defUses);
 
-    void remUnusedStmtEtc(UserProc *proc, RefCounter &refCounts);
+    /// \returns true if \p stmt may be removed from \p proc when it is not used.
+    bool isRemovable(UserProc *proc, const Statement *stmt) const;
 
     /// Remove statements of the form x := x
     bool removeNullStatements(UserProc *proc);
@@ -27,6 +27,19 @@ CallAndPhiFixPass::CallAndPhiFixPass()
 }
 
 
+PassFacts CallAndPhiFixPass::getInputs() const
+{
+    return makePassFacts({ PassFact::SSANames, PassFact::Statements, PassFact::CallDefines,
+                           PassFact::Preservations });
+}
+
+
+PassFacts CallAndPhiFixPass::getOutputs() const
+{
+    return makePassFacts({ PassFact::SSANames, PassFact::Statements });
+}
+
+
 bool CallAndPhiFixPass::execute(UserProc *proc)
 {
     /* Algorithm:
@@ -58,6 +71,8 @@ bool CallAndPhiFixPass::execute(UserProc *proc)
     StatementList stmts;
     proc->getStatements(stmts);
 
+    bool changed = false;
+
     // a[m[]] hack, aint nothing better.
     bool found = true;
 
@@ -85,7 +100,8 @@ bool CallAndPhiFixPass::execute(UserProc *proc)
                         (((e->access<RefExp, 1>())->getDef() == nullptr) ||
                          (e->access<RefExp, 1>())->getDef()->isImplicit())) {
                         a->setRight(Unary::get(opAddrOf, Location::memOf(e->clone())));
-                        found = true;
+                        found   = true;
+                        changed = true;
                     }
                 }
             }
@@ -93,7 +109,7 @@ bool CallAndPhiFixPass::execute(UserProc *proc)
     }
 
     if (found) {
-        PassManager::get()->executePass(PassID::BlockVarRename, proc);
+        changed |= PassManager::get()->executePass(PassID::BlockVarRename, proc);
     }
 
     // Scan for situations like this:
@@ -110,13 +126,15 @@ bool CallAndPhiFixPass::execute(UserProc *proc)
         PhiAssign *phi                 = static_cast<PhiAssign *>(s);
         std::shared_ptr<RefExp> refExp = RefExp::get(phi->getLeft(), phi);
 
+        const size_t numDefs = phi->getNumDefs();
         phi->removeAllReferences(refExp);
+        changed |= phi->getNumDefs() != numDefs;
     }
 
     // Second pass
     for (Statement *s : stmts) {
         if (!s->isPhi()) { // Ordinary statement
-            s->bypass();
+            changed |= s->bypass();
             continue;
         }
 
@@ -152,9 +170,11 @@ bool CallAndPhiFixPass::execute(UserProc *proc)
 
         if (cb.isModified()) { // Modified?
             // if first is of the form lhs{x}
-            if (first->isSubscript() && (*first->getSubExp1() == *lhs)) {
+            if (first->isSubscript() && (*first->getSubExp1() == *lhs) &&
+                first->access<RefExp>()->getDef() != phi_inf.getDef()) {
                 // replace first with x
                 phi_inf.setDef(first->access<RefExp>()->getDef());
+                changed = true;
             }
         }
 
@@ -174,9 +194,11 @@ bool CallAndPhiFixPass::execute(UserProc *proc)
 
             if (cb2.isModified()) {
                 // if current is of the form lhs{x}
-                if (current->isSubscript() && (*current->getSubExp1() == *lhs)) {
+                if (current->isSubscript() && (*current->getSubExp1() == *lhs) &&
+                    current->access<RefExp>()->getDef() != phi_inf2.getDef()) {
                     // replace current with x
                     phi_inf2.setDef(current->access<RefExp>()->getDef());
+                    changed = true;
                 }
             }
 
@@ -215,6 +237,7 @@ bool CallAndPhiFixPass::execute(UserProc *proc)
             }
 
             phi->convertToAssign(best);
+            changed = true;
             LOG_VERBOSE2("Redundant phi replaced with copy assign; now %1", phi);
         }
     }
@@ -231,8 +254,9 @@ bool CallAndPhiFixPass::execute(UserProc *proc)
 
         if (cb.isModified()) {
             cc->setSubExp1(addr);
+            changed = true;
         }
     }
 
-    return true;
+    return changed;
 }
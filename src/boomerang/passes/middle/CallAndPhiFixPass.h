@@ -20,6 +20,12 @@ public:
     CallAndPhiFixPass();
 
 public:
+    /// \copydoc IPass::getInputs
+    PassFacts getInputs() const override;
+
+    /// \copydoc IPass::getOutputs
+    PassFacts getOutputs() const override;
+
     /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
 };
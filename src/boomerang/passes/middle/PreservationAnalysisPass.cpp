@@ -17,6 +17,19 @@
 #include "boomerang/ssl/statements/ReturnStatement.h"
 #include "boomerang/util/log/Log.h"
 
+#include <algorithm>
+
+
+/// \returns true if \p a and \p b contain equal expressions
+static bool equalProvenTrue(const std::map<SharedExp, SharedExp, lessExpStar> &a,
+                            const std::map<SharedExp, SharedExp, lessExpStar> &b)
+{
+    return a.size() == b.size() &&
+           std::equal(a.begin(), a.end(), b.begin(), [](const auto &x, const auto &y) {
+               return *x.first == *y.first && *x.second == *y.second;
+           });
+}
+
 
 PreservationAnalysisPass::PreservationAnalysisPass()
     : IPass("PreservationAnalysis", PassID::PreservationAnalysis)
@@ -24,6 +37,18 @@ PreservationAnalysisPass::PreservationAnalysisPass()
 }
 
 
+PassFacts PreservationAnalysisPass::getInputs() const
+{
+    return makePassFacts({ PassFact::SSANames, PassFact::Statements, PassFact::CallDefines });
+}
+
+
+PassFacts PreservationAnalysisPass::getOutputs() const
+{
+    return makePassFacts({ PassFact::Preservations, PassFact::CallDefines });
+}
+
+
 bool PreservationAnalysisPass::execute(UserProc *proc)
 {
     std::set<SharedExp> removes;
@@ -36,6 +61,10 @@ bool PreservationAnalysisPass::execute(UserProc *proc)
         return false;
     }
 
+    // Proofs can also replace an existing entry, so compare contents instead of sizes
+    const auto oldProvenTrue         = proc->getProvenTrue();
+    const StatementList oldModifieds = proc->getRetStmt()->getModifieds();
+
     // prove preservation for all modifieds in the return statement
     for (Statement *mod : proc->getRetStmt()->getModifieds()) {
         SharedExp lhs = static_cast<Assignment *>(mod)->getLeft();
@@ -74,5 +103,8 @@ bool PreservationAnalysisPass::execute(UserProc *proc)
         proc->getRetStmt()->removeModified(lhs);
     }
 
-    return true;
+    return !equalProvenTrue(proc->getProvenTrue(), oldProvenTrue) ||
+           proc->getRetStmt()->getModifieds().size() != oldModifieds.size() ||
+           !std::equal(oldModifieds.begin(), oldModifieds.end(),
+                       proc->getRetStmt()->getModifieds().begin());
 }
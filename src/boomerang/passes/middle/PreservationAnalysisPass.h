@@ -19,6 +19,12 @@ public:
     PreservationAnalysisPass();
 
 public:
+    /// \copydoc IPass::getInputs
+    PassFacts getInputs() const override;
+
+    /// \copydoc IPass::getOutputs
+    PassFacts getOutputs() const override;
+
     /// \copydoc IPass::execute
     bool execute(UserProc *proc) override;
 };
@@ -0,0 +1,550 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "SCCPPass.h"
+
+#include "boomerang/db/BasicBlock.h"
+#include "boomerang/db/DefUseChains.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/passes/PassManager.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/statements/BranchStatement.h"
+#include "boomerang/ssl/statements/CallStatement.h"
+#include "boomerang/ssl/statements/PhiAssign.h"
+#include "boomerang/ssl/statements/ReturnStatement.h"
+#include "boomerang/ssl/type/Type.h"
+#include "boomerang/util/StatementList.h"
+#include "boomerang/util/log/Log.h"
+#include "boomerang/visitor/expmodifier/ExpModifier.h"
+
+#include <deque>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+
+/// Value of a definition in the constant propagation lattice
+struct LatticeValue
+{
+    enum Kind
+    {
+        Undefined,  ///< Not (yet) known to be executed
+        Constant,   ///< Always has the value \ref value
+        Overdefined ///< May have different values
+    };
+
+    LatticeValue(Kind _kind = Undefined, SharedExp _value = nullptr)
+        : kind(_kind)
+        , value(_value)
+    {
+    }
+
+    bool operator==(const LatticeValue &other) const
+    {
+        return kind == other.kind && (kind != Constant || *value == *other.value);
+    }
+
+    bool operator!=(const LatticeValue &other) const { return !(*this == other); }
+
+    /// Lattice meet
+    LatticeValue meet(const LatticeValue &other) const
+    {
+        if (kind == Undefined) {
+            return other;
+        }
+        else if (other.kind == Undefined) {
+            return *this;
+        }
+        else if (kind == Constant && *this == other) {
+            return *this;
+        }
+
+        return LatticeValue(Overdefined);
+    }
+
+    Kind kind;
+    SharedExp value; ///< Only for constants
+};
+
+
+/// Finds the lattice values of all definitions and the executable edges of a procedure.
+class SCCPSolver
+{
+public:
+    /// \param assumeAllExecutable if true, all CFG edges are treated as executable,
+    /// i.e. only constants are propagated.
+    SCCPSolver(UserProc *proc, bool assumeAllExecutable);
+
+public:
+    void solve();
+
+    bool isExecutable(const BasicBlock *bb) const { return m_executableBBs.count(bb) > 0; }
+    bool isExecutable(const BasicBlock *from, const BasicBlock *to) const;
+
+    /// \returns the lattice value of the definition \p def
+    LatticeValue getValue(const Statement *def) const;
+
+    /// \returns the lattice value of \p exp
+    /// using the current lattice values of all definitions referenced by \p exp
+    LatticeValue evaluate(const SharedExp &exp) const;
+
+    const DefUseChains &getDefUseChains() const { return m_defUse; }
+
+private:
+    void visitBB(BasicBlock *bb, bool onlyPhis);
+    void visitStatement(Statement *stmt);
+    void visitBranch(BranchStatement *branch);
+
+    /// Update the lattice value of \p def and revisit all uses of \p def if the value changed.
+    void setValue(Statement *def, const LatticeValue &val);
+
+    void addEdge(BasicBlock *from, BasicBlock *to);
+
+private:
+    UserProc *m_proc;
+    bool m_assumeAllExecutable;
+    DefUseChains m_defUse;
+
+    std::unordered_map<const Statement *, LatticeValue> m_values;
+    std::unordered_set<const BasicBlock *> m_executableBBs;
+    std::set<std::pair<const BasicBlock *, const BasicBlock *>> m_executableEdges;
+
+    std::deque<std::pair<BasicBlock *, BasicBlock *>> m_edgeWorkList;
+    std::deque<Statement *> m_stmtWorkList;
+};
+
+
+/// Replaces references to constant definitions by the constants
+class SCCPConstSubstituter : public ExpModifier
+{
+public:
+    explicit SCCPConstSubstituter(const SCCPSolver &solver)
+        : m_solver(solver)
+    {
+    }
+
+public:
+    /// Whether a reference to a definition with undefined value was found
+    bool hasUndefined() const { return m_hasUndefined; }
+
+    /// \copydoc ExpModifier::postModify
+    SharedExp postModify(const std::shared_ptr<RefExp> &exp) override
+    {
+        const LatticeValue val = m_solver.getValue(exp->getDef());
+
+        if (val.kind == LatticeValue::Undefined) {
+            m_hasUndefined = true;
+        }
+        else if (val.kind == LatticeValue::Constant) {
+            return val.value->clone();
+        }
+
+        return exp;
+    }
+
+private:
+    const SCCPSolver &m_solver;
+    bool m_hasUndefined = false;
+};
+
+
+SCCPSolver::SCCPSolver(UserProc *proc, bool assumeAllExecutable)
+    : m_proc(proc)
+    , m_assumeAllExecutable(assumeAllExecutable)
+{
+}
+
+
+void SCCPSolver::solve()
+{
+    BasicBlock *entryBB = m_proc->getCFG()->getEntryBB();
+    if (!entryBB) {
+        return;
+    }
+
+    StatementList stmts;
+    m_proc->getStatements(stmts);
+    m_defUse.build(stmts);
+
+    m_edgeWorkList.push_back({ nullptr, entryBB });
+
+    while (!m_edgeWorkList.empty() || !m_stmtWorkList.empty()) {
+        while (!m_edgeWorkList.empty()) {
+            BasicBlock *from = m_edgeWorkList.front().first;
+            BasicBlock *to   = m_edgeWorkList.front().second;
+            m_edgeWorkList.pop_front();
+
+            if (from && !m_executableEdges.insert({ from, to }).second) {
+                continue; // already known to be executable
+            }
+
+            // Each new incoming edge can change the value of the phis,
+            // all other statements only need to be visited once.
+            const bool firstVisit = m_executableBBs.insert(to).second;
+            visitBB(to, !firstVisit);
+        }
+
+        while (!m_stmtWorkList.empty()) {
+            Statement *stmt = m_stmtWorkList.front();
+            m_stmtWorkList.pop_front();
+
+            if (isExecutable(stmt->getBB())) {
+                visitStatement(stmt);
+            }
+        }
+    }
+}
+
+
+bool SCCPSolver::isExecutable(const BasicBlock *from, const BasicBlock *to) const
+{
+    return m_executableEdges.find({ from, to }) != m_executableEdges.end();
+}
+
+
+LatticeValue SCCPSolver::getValue(const Statement *def) const
+{
+    if (!def || !(def->isAssign() || def->isPhi())) {
+        // implicit definitions, calls etc.
+        return LatticeValue(LatticeValue::Overdefined);
+    }
+
+    auto it = m_values.find(def);
+    return it != m_values.end() ? it->second : LatticeValue(LatticeValue::Undefined);
+}
+
+
+LatticeValue SCCPSolver::evaluate(const SharedExp &exp) const
+{
+    SCCPConstSubstituter substituter(*this);
+    SharedExp result = exp->clone()->acceptModifier(&substituter);
+
+    if (substituter.hasUndefined()) {
+        return LatticeValue(LatticeValue::Undefined);
+    }
+
+    result = result->simplify();
+    return result->isIntConst() ? LatticeValue(LatticeValue::Constant, result)
+                                : LatticeValue(LatticeValue::Overdefined);
+}
+
+
+void SCCPSolver::visitBB(BasicBlock *bb, bool onlyPhis)
+{
+    BasicBlock::RTLIterator rit;
+    StatementList::iterator sit;
+    bool hasBranch = false;
+
+    for (Statement *stmt = bb->getFirstStmt(rit, sit); stmt; stmt = bb->getNextStmt(rit, sit)) {
+        if (stmt->isPhi()) {
+            visitStatement(stmt);
+        }
+        else if (!onlyPhis) {
+            visitStatement(stmt);
+            hasBranch |= stmt->isBranch() && bb->getNumSuccessors() == 2;
+        }
+    }
+
+    if (!onlyPhis && (!hasBranch || m_assumeAllExecutable)) {
+        for (BasicBlock *succ : bb->getSuccessors()) {
+            addEdge(bb, succ);
+        }
+    }
+}
+
+
+void SCCPSolver::visitStatement(Statement *stmt)
+{
+    if (stmt->isPhi()) {
+        PhiAssign *phi = static_cast<PhiAssign *>(stmt);
+        LatticeValue val;
+
+        for (const auto &def : phi->getDefs()) {
+            if (isExecutable(def.first, phi->getBB())) {
+                val = val.meet(getValue(def.second.getDef()));
+            }
+        }
+
+        setValue(phi, val);
+    }
+    else if (stmt->isAssign()) {
+        Assign *asgn = static_cast<Assign *>(stmt);
+
+        if (asgn->getGuard() || (asgn->getType() && asgn->getType()->isFloat())) {
+            setValue(asgn, LatticeValue(LatticeValue::Overdefined));
+        }
+        else {
+            setValue(asgn, evaluate(asgn->getRight()));
+        }
+    }
+    else if (stmt->isBranch()) {
+        visitBranch(static_cast<BranchStatement *>(stmt));
+    }
+}
+
+
+void SCCPSolver::visitBranch(BranchStatement *branch)
+{
+    BasicBlock *bb = branch->getBB();
+    if (m_assumeAllExecutable || bb->getNumSuccessors() != 2) {
+        return; // successors are added by visitBB
+    }
+
+    const LatticeValue cond = branch->getCondExpr() ? evaluate(branch->getCondExpr())
+                                                    : LatticeValue(LatticeValue::Overdefined);
+
+    switch (cond.kind) {
+    case LatticeValue::Undefined: break;
+    case LatticeValue::Constant:
+        addEdge(bb, cond.value->access<Const>()->getInt() != 0 ? branch->getTakenBB()
+                                                               : branch->getFallBB());
+        break;
+    case LatticeValue::Overdefined:
+        addEdge(bb, branch->getTakenBB());
+        addEdge(bb, branch->getFallBB());
+        break;
+    }
+}
+
+
+void SCCPSolver::setValue(Statement *def, const LatticeValue &val)
+{
+    LatticeValue &oldVal = m_values[def];
+
+    // Values can only go down in the lattice
+    const LatticeValue newVal = (oldVal.kind == LatticeValue::Undefined) ? val : oldVal.meet(val);
+    if (newVal == oldVal) {
+        return;
+    }
+
+    oldVal = newVal;
+
+    for (Statement *use : m_defUse.getUses(def)) {
+        m_stmtWorkList.push_back(use);
+    }
+}
+
+
+void SCCPSolver::addEdge(BasicBlock *from, BasicBlock *to)
+{
+    if (to && !isExecutable(from, to)) {
+        m_edgeWorkList.push_back({ from, to });
+    }
+}
+
+
+SCCPPass::SCCPPass()
+    : IPass("SCCP", PassID::SCCP)
+{
+}
+
+
+bool SCCPPass::execute(UserProc *proc)
+{
+    SCCPSolver solver(proc, false);
+    solver.solve();
+
+    // Removing the BB with the return statement would leave the procedure in an inconsistent
+    // state, and so would removing definitions that are still referenced elsewhere.
+    // In these cases, only propagate constants.
+    const ReturnStatement *retStmt = proc->getRetStmt();
+    const BasicBlock *exitBB       = proc->getCFG()->getExitBB();
+
+    const bool canRemoveCode = (!retStmt || solver.isExecutable(retStmt->getBB())) &&
+                               (!exitBB || solver.isExecutable(exitBB)) &&
+                               canRemoveUnreachableBBs(proc, solver);
+
+    if (!canRemoveCode) {
+        SCCPSolver constSolver(proc, true);
+        constSolver.solve();
+        return replaceConstantDefs(proc, constSolver);
+    }
+
+    bool change = replaceConstantDefs(proc, solver);
+    change |= removeUnreachableCode(proc, solver);
+    return change;
+}
+
+
+bool SCCPPass::canRemoveUnreachableBBs(UserProc *proc, const SCCPSolver &solver) const
+{
+    for (BasicBlock *bb : *proc->getCFG()) {
+        if (solver.isExecutable(bb)) {
+            continue;
+        }
+
+        BasicBlock::RTLIterator rit;
+        StatementList::iterator sit;
+
+        for (Statement *def = bb->getFirstStmt(rit, sit); def; def = bb->getNextStmt(rit, sit)) {
+            for (Statement *use : solver.getDefUseChains().getUses(def)) {
+                if (!solver.isExecutable(use->getBB())) {
+                    continue; // removed as well
+                }
+                else if (!use->isPhi()) {
+                    return false;
+                }
+
+                // Phi operands from non-executable edges are removed together with the edge
+                for (const auto &phiDef : static_cast<PhiAssign *>(use)->getDefs()) {
+                    if (phiDef.second.getDef() == def &&
+                        solver.isExecutable(phiDef.first, use->getBB())) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+
+bool SCCPPass::replaceConstantDefs(UserProc *proc, const SCCPSolver &solver)
+{
+    bool change = false;
+
+    for (Statement *stmt : proc->getCFG()->getStatements()) {
+        if (!solver.isExecutable(stmt->getBB()) || !(stmt->isAssign() || stmt->isPhi())) {
+            continue;
+        }
+
+        const LatticeValue val = solver.getValue(stmt);
+        if (val.kind != LatticeValue::Constant) {
+            continue;
+        }
+
+        if (stmt->isPhi()) {
+            LOG_VERBOSE("SCCP: Replacing phi with constant %1: %2", val.value, stmt);
+            static_cast<PhiAssign *>(stmt)->convertToAssign(val.value->clone());
+            change = true;
+        }
+        else if (!static_cast<Assign *>(stmt)->getRight()->isIntConst()) {
+            LOG_VERBOSE("SCCP: Replacing right hand side with constant %1: %2", val.value, stmt);
+            static_cast<Assign *>(stmt)->setRight(val.value->clone());
+            change = true;
+        }
+    }
+
+    return change;
+}
+
+
+/// Remove the operands for the predecessor \p pred from all phis in \p bb
+static void removePhiOperands(BasicBlock *bb, BasicBlock *pred)
+{
+    BasicBlock::RTLIterator rit;
+    StatementList::iterator sit;
+
+    for (Statement *stmt = bb->getFirstStmt(rit, sit); stmt; stmt = bb->getNextStmt(rit, sit)) {
+        if (stmt->isPhi()) {
+            static_cast<PhiAssign *>(stmt)->getDefs().erase(pred);
+        }
+    }
+}
+
+
+/// Remove all calls in \p bb from the callers of their callees, so they do not keep
+/// pointers to the calls after \p bb is deleted.
+static void removeCallers(BasicBlock *bb)
+{
+    BasicBlock::RTLIterator rit;
+    StatementList::iterator sit;
+
+    for (Statement *stmt = bb->getFirstStmt(rit, sit); stmt; stmt = bb->getNextStmt(rit, sit)) {
+        if (!stmt->isCall()) {
+            continue;
+        }
+
+        CallStatement *call = static_cast<CallStatement *>(stmt);
+        if (call->getDestProc()) {
+            call->getDestProc()->removeCaller(call);
+        }
+    }
+}
+
+
+bool SCCPPass::removeUnreachableCode(UserProc *proc, const SCCPSolver &solver)
+{
+    ProcCFG *cfg        = proc->getCFG();
+    bool cfgChanged     = false;
+    bool branchesFolded = false;
+
+    // Branches with constant conditions
+    for (BasicBlock *bb : *cfg) {
+        if (!solver.isExecutable(bb) || !bb->isType(BBType::Twoway) ||
+            bb->getNumSuccessors() != 2) {
+            continue;
+        }
+
+        Statement *last = bb->getLastStmt();
+        if (!last || !last->isBranch()) {
+            continue;
+        }
+
+        BranchStatement *branch = static_cast<BranchStatement *>(last);
+        BasicBlock *takenBB     = branch->getTakenBB();
+        BasicBlock *fallBB      = branch->getFallBB();
+
+        const bool takenExecutable = solver.isExecutable(bb, takenBB);
+        const bool fallExecutable  = solver.isExecutable(bb, fallBB);
+
+        if (takenBB == fallBB || takenExecutable == fallExecutable) {
+            continue;
+        }
+
+        LOG_VERBOSE("SCCP: Branch at %1 is always %2", bb->getLowAddr(),
+                    takenExecutable ? "taken" : "not taken");
+
+        removePhiOperands(takenExecutable ? fallBB : takenBB, bb);
+
+        // Let the BB turn the branch into a goto (or remove it) and fix up its out edges
+        branch->setCondExpr(Const::get(takenExecutable ? 1 : 0));
+        bb->simplify();
+        branchesFolded = true;
+    }
+
+    // BBs that are never executed
+    std::vector<BasicBlock *> unreachableBBs;
+    for (BasicBlock *bb : *cfg) {
+        if (!solver.isExecutable(bb)) {
+            unreachableBBs.push_back(bb);
+        }
+    }
+
+    for (BasicBlock *bb : unreachableBBs) {
+        const std::vector<BasicBlock *> successors   = bb->getSuccessors();
+        const std::vector<BasicBlock *> predecessors = bb->getPredecessors();
+
+        for (BasicBlock *succ : successors) {
+            removePhiOperands(succ, bb);
+            succ->removePredecessor(bb);
+        }
+
+        for (BasicBlock *pred : predecessors) {
+            pred->removeSuccessor(bb);
+        }
+    }
+
+    for (BasicBlock *bb : unreachableBBs) {
+        LOG_VERBOSE("SCCP: Removing unreachable BB at address %1", bb->getLowAddr());
+        removeCallers(bb);
+        cfg->removeBB(bb);
+        cfgChanged = true;
+    }
+
+    if (cfgChanged || branchesFolded) {
+        PassManager::get()->executePass(PassID::Dominators, proc);
+    }
+
+    return cfgChanged || branchesFolded;
+}
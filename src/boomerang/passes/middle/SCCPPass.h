@@ -0,0 +1,54 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/passes/Pass.h"
+
+
+class SCCPSolver;
+
+
+/**
+ * Sparse conditional constant propagation (Wegman and Zadeck).
+ *
+ * Definitions are evaluated over the lattice undefined > constant > overdefined
+ * while keeping track of which CFG edges can be executed, so constants flowing
+ * through phi functions and branches with constant conditions are found
+ * in a single sweep over the SSA graph. Afterwards,
+ *  - assignments and phi functions with a constant value are replaced
+ *    by assignments of the constant,
+ *  - branches with a constant condition are replaced by gotos (or removed),
+ *  - basic blocks that can never be executed are removed.
+ */
+class SCCPPass final : public IPass
+{
+public:
+    SCCPPass();
+
+public:
+    /// \copydoc IPass::isProcLocal
+    bool isProcLocal() const override { return true; }
+
+    /// \copydoc IPass::execute
+    bool execute(UserProc *proc) override;
+
+private:
+    /// \returns true if removing all unreachable BBs does not leave dangling references
+    /// to statements in these BBs.
+    bool canRemoveUnreachableBBs(UserProc *proc, const SCCPSolver &solver) const;
+
+    /// Replace assignments and phis with a constant value by assignments of the constant.
+    bool replaceConstantDefs(UserProc *proc, const SCCPSolver &solver);
+
+    /// Replace branches with a constant condition by gotos
+    /// and remove all basic blocks that cannot be executed.
+    bool removeUnreachableCode(UserProc *proc, const SCCPSolver &solver);
+};
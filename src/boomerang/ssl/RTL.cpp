@@ -9,6 +9,7 @@
 #pragma endregion License
 #include "RTL.h"
 
+#include "boomerang/db/BasicBlock.h"
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Operator.h"
 #include "boomerang/ssl/statements/Assign.h"
@@ -67,6 +68,7 @@ RTL &RTL::operator=(const RTL &other)
     clear();
 
     other.deepCopyList(m_stmts);
+    markModified();
     return *this;
 }
 
@@ -89,6 +91,7 @@ void RTL::append(Statement *s)
     }
 
     m_stmts.push_back(s);
+    markModified();
 }
 
 
@@ -97,6 +100,8 @@ void RTL::append(const std::list<Statement *> &stmts)
     for (Statement *stmt : stmts) {
         m_stmts.push_back(stmt->clone());
     }
+
+    markModified();
 }
 
 
@@ -161,6 +166,7 @@ void RTL::simplify()
                 BasicBlock *bb = (*it)->getBB();
                 *it = new GotoStatement(static_cast<BranchStatement *>(s)->getFixedDest());
                 (*it)->setBB(bb);
+                markModified();
             }
         }
         else if (s->isAssign()) {
@@ -206,4 +212,48 @@ Statement *RTL::getHlStmt() const
 void RTL::insert(RTL::iterator where, const RTL::value_type &val)
 {
     m_stmts.insert(where, val);
+    markModified();
+}
+
+
+void RTL::pop_front()
+{
+    m_stmts.pop_front();
+    markModified();
+}
+
+
+void RTL::pop_back()
+{
+    m_stmts.pop_back();
+    markModified();
+}
+
+
+void RTL::push_front(const value_type &val)
+{
+    m_stmts.push_front(val);
+    markModified();
+}
+
+
+void RTL::clear()
+{
+    m_stmts.clear();
+    markModified();
+}
+
+
+RTL::iterator RTL::erase(iterator it)
+{
+    markModified();
+    return m_stmts.erase(it);
+}
+
+
+void RTL::markModified()
+{
+    if (m_bb) {
+        m_bb->markModified();
+    }
 }
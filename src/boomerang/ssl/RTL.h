@@ -16,6 +16,7 @@
 #include <memory>
 
 
+class BasicBlock;
 class Statement;
 class OStream;
 
@@ -100,6 +101,17 @@ public:
 
     const std::list<Statement *> &getStatements() const { return m_stmts; }
 
+    /// Set the BB that contains this RTL. Not copied by the copy constructor.
+    void setBB(BasicBlock *bb) { m_bb = bb; }
+
+    /**
+     * Mark the statements of the containing BB as modified.
+     * Must be called after replacing statements in place (e.g. via back() or an iterator);
+     * all other modifying members of this class call it automatically.
+     * \sa ProcCFG::getModificationCount
+     */
+    void markModified();
+
     // delegates to std::list
 public:
     bool empty() const { return m_stmts.empty(); }
@@ -121,19 +133,20 @@ public:
     const_reverse_iterator rbegin() const { return m_stmts.rbegin(); }
     const_reverse_iterator rend() const { return m_stmts.rend(); }
 
-    void pop_front() { m_stmts.pop_front(); }
-    void pop_back() { m_stmts.pop_back(); }
+    void pop_front();
+    void pop_back();
 
-    void push_front(const value_type &val) { m_stmts.push_front(val); }
+    void push_front(const value_type &val);
 
     void insert(iterator where, const value_type &val);
-    void clear() { m_stmts.clear(); }
+    void clear();
 
-    iterator erase(iterator it) { return m_stmts.erase(it); }
+    iterator erase(iterator it);
 
 private:
     std::list<Statement *> m_stmts;
-    Address m_nativeAddr; ///< RTL's source program instruction address
+    Address m_nativeAddr;       ///< RTL's source program instruction address
+    BasicBlock *m_bb = nullptr; ///< BB containing this RTL, if any
 };
 
 using SharedRTL = std::shared_ptr<RTL>;
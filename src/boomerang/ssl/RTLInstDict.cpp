@@ -65,6 +65,12 @@ bool RTLInstDict::readSSLFile(const QString &sslFileName)
         return false;
     }
 
+    // Handles are the positions of the instructions in the (sorted) dictionary.
+    m_instructionsByHandle.reserve(m_instructions.size());
+    for (auto it = m_instructions.begin(); it != m_instructions.end(); ++it) {
+        m_instructionsByHandle.push_back(it);
+    }
+
     if (m_verboseOutput) {
         OStream q_cout(stdout);
         q_cout << "\n=======Expanded RTL template dictionary=======\n";
@@ -122,6 +128,49 @@ std::pair<QString, DWord> RTLInstDict::getSignature(const QString &instructionNa
 }
 
 
+int RTLInstDict::getInstructionHandle(const QString &name) const
+{
+    const QString sanitizedName = QString(name).remove(".").toUpper();
+
+    const auto it = m_instructions.find(sanitizedName);
+    if (it == m_instructions.end()) {
+        return -1;
+    }
+
+    return static_cast<int>(std::distance(m_instructions.begin(), it));
+}
+
+
+int RTLInstDict::getNumParams(int handle) const
+{
+    assert(handle >= 0 && handle < static_cast<int>(m_instructionsByHandle.size()));
+    return static_cast<int>(m_instructionsByHandle[handle]->second.m_params.size());
+}
+
+
+std::unique_ptr<RTL> RTLInstDict::instantiateRTL(int handle, Address natPC,
+                                                 const std::vector<SharedExp> &args)
+{
+    if (handle < 0 || handle >= static_cast<int>(m_instructionsByHandle.size())) {
+        return nullptr; // instruction not found
+    }
+
+    const QString &name = m_instructionsByHandle[handle]->first;
+    TableEntry &entry   = m_instructionsByHandle[handle]->second;
+
+    std::unique_ptr<RTL> rtl = instantiateRTL(entry.m_rtl, natPC, entry.m_params, args);
+    if (rtl) {
+        return rtl;
+    }
+    else {
+        LOG_ERROR("Cannot instantiate instruction '%1' at address %2: "
+                  "Instruction has %3 parameters, but got %4 arguments",
+                  name, natPC, entry.m_params.size(), args.size());
+        return nullptr;
+    }
+}
+
+
 std::unique_ptr<RTL> RTLInstDict::instantiateRTL(const QString &name, Address natPC,
                                                  const std::vector<SharedExp> &args)
 {
@@ -204,6 +253,7 @@ void RTLInstDict::reset()
 
     m_definedParams.clear();
     m_flagFuncs.clear();
+    m_instructionsByHandle.clear();
     m_instructions.clear();
 }
 
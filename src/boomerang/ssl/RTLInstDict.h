@@ -64,6 +64,17 @@ public:
     /// \returns the name and the number of operands of the instruction
     std::pair<QString, DWord> getSignature(const QString &name, bool *found = nullptr) const;
 
+    /**
+     * Look up the instruction with name \p name once, so it can be instantiated
+     * later without looking up (and sanitizing) its name again.
+     * Handles are valid until the next SSL file is read.
+     * \returns the handle of the instruction, or -1 if the instruction does not exist.
+     */
+    int getInstructionHandle(const QString &name) const;
+
+    /// \returns the number of parameters of the instruction with handle \p handle
+    int getNumParams(int handle) const;
+
     /**
      * Returns a new RTL containing the semantics of the instruction with name \p name.
      *
@@ -74,6 +85,11 @@ public:
     std::unique_ptr<RTL> instantiateRTL(const QString &name, Address pc,
                                         const std::vector<SharedExp> &args);
 
+    /// Same as above, but for the instruction with handle \p handle
+    /// (see \ref getInstructionHandle).
+    std::unique_ptr<RTL> instantiateRTL(int handle, Address pc,
+                                        const std::vector<SharedExp> &args);
+
     RegDB *getRegDB();
     const RegDB *getRegDB() const;
 
@@ -130,4 +146,7 @@ private:
 
     /// The actual instruction dictionary.
     std::map<QString, TableEntry> m_instructions;
+
+    /// All instructions of the dictionary, indexed by their handle
+    std::vector<std::map<QString, TableEntry>::iterator> m_instructionsByHandle;
 };
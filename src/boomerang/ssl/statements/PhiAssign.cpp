@@ -225,6 +225,11 @@ void PhiAssign::convertToAssign(SharedExp rhs)
     a->setNumber(n);
     a->setProc(p);
     a->setBB(bb);
+
+    // the statement is not a phi any more
+    if (bb) {
+        bb->markModified();
+    }
 }
 
 
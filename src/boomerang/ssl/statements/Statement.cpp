@@ -120,8 +120,7 @@ bool Statement::canPropagateToExp(const Exp &exp)
 }
 
 
-bool Statement::propagateTo(bool &convert, Settings *settings,
-                            std::map<SharedExp, int, lessExpStar> *destCounts,
+bool Statement::propagateTo(bool &convert, Settings *settings, const ExpIntMap *destCounts,
                             LocationSet *usedByDomPhi, bool force)
 {
     bool change            = false;
@@ -219,7 +218,7 @@ bool Statement::propagateTo(bool &convert, Settings *settings,
                 change |= doPropagateTo(e, def, convert, settings);
             }
             else {
-                std::map<SharedExp, int, lessExpStar>::iterator ff = destCounts->find(e);
+                ExpIntMap::const_iterator ff = destCounts->find(e);
 
                 if (ff == destCounts->end()) {
                     change |= doPropagateTo(e, def, convert, settings);
@@ -485,7 +484,7 @@ bool Statement::isNullStatement() const
 }
 
 
-void Statement::bypass()
+bool Statement::bypass()
 {
     // Use the Part modifier so we don't change the top level of LHS of assigns etc
     CallBypasser cb(this);
@@ -496,6 +495,8 @@ void Statement::bypass()
     if (cb.isTopChanged()) {
         simplify(); // E.g. m[esp{20}] := blah -> m[esp{-}-20+4] := blah
     }
+
+    return cb.isModified();
 }
 
 
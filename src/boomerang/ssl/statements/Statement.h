@@ -239,7 +239,7 @@ public:
      * \param usedByDomPhi is a set of subscripted locations used in phi statements
      * \returns true if a change
      */
-    bool propagateTo(bool &convert, Settings *settings, ExpIntMap *destCounts = nullptr,
+    bool propagateTo(bool &convert, Settings *settings, const ExpIntMap *destCounts = nullptr,
                      LocationSet *usedByDomPhi = nullptr, bool force = false);
 
     /// Experimental: may want to propagate flags first,
@@ -272,7 +272,8 @@ public:
 
     /// Fix references to the returns of call statements
     /// Bypass calls for references in this statement
-    void bypass();
+    /// \returns true if any reference was bypassed
+    bool bypass();
 
     /// Get the type for the definition, if any, for expression e in this statement
     /// Overridden only by Assignment and CallStatement, and ReturnStatement.
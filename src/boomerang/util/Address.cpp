@@ -10,6 +10,7 @@
 #include "Address.h"
 
 #include "boomerang/util/ByteUtil.h"
+#include "boomerang/util/OStream.h"
 #include "boomerang/util/log/Log.h"
 
 #include <cassert>
@@ -82,11 +83,11 @@ QString HostAddress::toString() const
 
 OStream &operator<<(OStream &os, const Address &addr)
 {
-    return os << addr.toString();
+    return os << "0x" << HexNumber(addr.value(), Address::getSourceBits() / 4);
 }
 
 
 OStream &operator<<(OStream &os, const HostAddress &addr)
 {
-    return os << addr.toString();
+    return os << "0x" << HexNumber(addr.value(), 2 * sizeof(HostAddress::value_type));
 }
@@ -10,6 +10,35 @@
 #include "ByteUtil.h"
 
 #include <cassert>
+#include <cstring>
+
+
+/// Swap the bytes of all \p count values at \p values in place.
+/// This loop is simple enough to be vectorized by the compiler.
+template<typename T>
+static void swapEndianArray(T *values, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++) {
+        values[i] = Util::swapEndian(values[i]);
+    }
+}
+
+
+template<typename T>
+static void readArray(T *dst, const void *src, std::size_t count, Endian srcEndian)
+{
+    if (count == 0) {
+        return;
+    }
+
+    assert(dst && src);
+    constexpr Endian myEndian = static_cast<Endian>(BOOMERANG_BIG_ENDIAN);
+    std::memcpy(dst, src, count * sizeof(T));
+
+    if (srcEndian != myEndian) {
+        swapEndianArray(dst, count);
+    }
+}
 
 
 namespace Util
@@ -63,6 +92,24 @@ QWord readQWord(const void *src, Endian srcEndian)
 }
 
 
+void readWords(SWord *dst, const void *src, std::size_t count, Endian srcEndian)
+{
+    readArray(dst, src, count, srcEndian);
+}
+
+
+void readDWords(DWord *dst, const void *src, std::size_t count, Endian srcEndian)
+{
+    readArray(dst, src, count, srcEndian);
+}
+
+
+void readQWords(QWord *dst, const void *src, std::size_t count, Endian srcEndian)
+{
+    readArray(dst, src, count, srcEndian);
+}
+
+
 void writeByte(void *dst, Byte value)
 {
     assert(dst);
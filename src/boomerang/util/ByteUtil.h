@@ -13,6 +13,7 @@
 #include "boomerang/core/BoomerangAPI.h"
 #include "boomerang/util/Types.h"
 
+#include <cstddef>
 #include <initializer_list>
 #include <type_traits>
 
@@ -79,6 +80,16 @@ BOOMERANG_API SWord readWord(const void *src, Endian srcEndian);
 BOOMERANG_API DWord readDWord(const void *src, Endian srcEndian);
 BOOMERANG_API QWord readQWord(const void *src, Endian srcEndian);
 
+/**
+ * Read \p count consecutive values from \p src into \p dst, respecting endianness.
+ * Use this for converting whole tables instead of reading the values one by one.
+ * \note \p src does not need to be aligned. \p src and \p dst must not overlap.
+ * \sa readWord, readDWord, readQWord
+ */
+BOOMERANG_API void readWords(SWord *dst, const void *src, std::size_t count, Endian srcEndian);
+BOOMERANG_API void readDWords(DWord *dst, const void *src, std::size_t count, Endian srcEndian);
+BOOMERANG_API void readQWords(QWord *dst, const void *src, std::size_t count, Endian srcEndian);
+
 
 /// Write values to \p dst, respecting endianness
 BOOMERANG_API void writeByte(void *dst, Byte value);
@@ -0,0 +1,58 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "CancellationToken.h"
+
+#include <limits>
+
+
+CancellationToken::CancellationToken()
+    : m_cancelled(false)
+    , m_deadline(std::numeric_limits<std::chrono::steady_clock::rep>::max())
+{
+}
+
+
+void CancellationToken::cancel()
+{
+    m_cancelled = true;
+}
+
+
+void CancellationToken::setTimeout(std::chrono::milliseconds timeout)
+{
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+
+    m_deadline = deadline.time_since_epoch().count();
+}
+
+
+void CancellationToken::reset()
+{
+    m_deadline  = std::numeric_limits<std::chrono::steady_clock::rep>::max();
+    m_cancelled = false;
+}
+
+
+bool CancellationToken::isCancelled() const
+{
+    if (m_cancelled) {
+        return true;
+    }
+
+    const auto deadline = m_deadline.load();
+    if (deadline == std::numeric_limits<std::chrono::steady_clock::rep>::max() ||
+        std::chrono::steady_clock::now().time_since_epoch().count() < deadline) {
+        return false;
+    }
+
+    m_cancelled = true;
+    return true;
+}
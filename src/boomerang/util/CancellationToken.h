@@ -0,0 +1,55 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+
+#include <atomic>
+#include <chrono>
+
+
+/**
+ * Cooperative cancellation of long running work (decoding, decompilation).
+ * Cancellation can be requested explicitly from any thread, or happens automatically
+ * once a timeout has passed. Long running loops check isCancelled() at points where
+ * stopping leaves all data in a consistent state.
+ */
+class BOOMERANG_API CancellationToken
+{
+public:
+    CancellationToken();
+    CancellationToken(const CancellationToken &other) = delete;
+    CancellationToken(CancellationToken &&other)      = delete;
+
+    ~CancellationToken() = default;
+
+    CancellationToken &operator=(const CancellationToken &other) = delete;
+    CancellationToken &operator=(CancellationToken &&other) = delete;
+
+public:
+    /// Request cancellation.
+    void cancel();
+
+    /// Request cancellation automatically when \p timeout has passed from now.
+    void setTimeout(std::chrono::milliseconds timeout);
+
+    /// Withdraw any cancellation request and timeout.
+    void reset();
+
+    /// \returns true if cancellation was requested or the timeout has passed.
+    bool isCancelled() const;
+
+private:
+    mutable std::atomic<bool> m_cancelled;
+
+    /// Time since the clock's epoch when the timeout expires, or max() if there is no timeout.
+    std::atomic<std::chrono::steady_clock::rep> m_deadline;
+};
@@ -189,7 +189,7 @@ void ExpPrinter::printPlain(OStream &os, const SharedConstExp &exp) const
     case opLongConst:
         if ((static_cast<long long>(exp->access<const Const>()->getLong()) < -1000LL) ||
             (static_cast<long long>(exp->access<const Const>()->getLong()) > +1000LL)) {
-            os << "0x" << QString::number(exp->access<const Const>()->getLong(), 16) << "LL";
+            os << "0x" << HexNumber(exp->access<const Const>()->getLong()) << "LL";
         }
         else {
             os << exp->access<const Const>()->getLong() << "LL";
@@ -14,94 +14,280 @@
 #include <QString>
 #include <QTextStream>
 
+#include <algorithm>
+#include <cstring>
+
+
+/// Buffered output is written to the target file when the buffer exceeds this size
+/// (same as QTextStream)
+static constexpr std::size_t MAX_BUFFER_SIZE = 16384;
+
+
+/// Format \p value as decimal number into the buffer ending at \p end.
+/// \returns a pointer to the first character of the number.
+static char *formatDecimal(uint64 value, char *end)
+{
+    char *p = end;
+
+    do {
+        *--p = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    return p;
+}
+
 
 OStream::OStream(QFile *tgt)
-    : m_os(new QTextStream(tgt))
+    : m_device(tgt)
 {
 }
 
 
 OStream::OStream(QString *tgt)
-    : m_os(new QTextStream(tgt))
+    : m_string(tgt)
 {
 }
 
 
 OStream::OStream(FILE *tgt)
-    : m_os(new QTextStream(tgt))
+    : m_file(tgt)
 {
 }
 
 
 OStream::OStream(QSaveFile *tgt)
-    : m_os(new QTextStream(tgt))
+    : m_device(tgt)
 {
 }
 
 
 OStream::~OStream()
 {
-    delete m_os;
+    flushBuffer();
 }
 
 
 OStream &OStream::operator<<(const QString &rhs)
 {
-    *m_os << rhs;
+    const int len = rhs.length();
+    writePadding(getPaddingBefore(len));
+
+    if (m_string) {
+        m_string->append(rhs);
+    }
+    else {
+        const QByteArray utf8 = rhs.toUtf8();
+        m_buffer.append(utf8.constData(), utf8.size());
+    }
+
+    writePadding(getPaddingAfter(len));
+
+    if (m_buffer.size() > MAX_BUFFER_SIZE) {
+        flushBuffer();
+    }
+
     return *this;
 }
 
 
 OStream &OStream::operator<<(const QTextStreamManipulator &rhs)
 {
-    *m_os << rhs;
+    // Manipulators can only be applied to a QTextStream,
+    // so apply them to a dummy stream and copy the resulting format.
+    static thread_local QTextStream formatStream;
+
+    formatStream.setFieldWidth(m_fieldWidth);
+    formatStream.setFieldAlignment(static_cast<QTextStream::FieldAlignment>(m_fieldAlignment));
+    formatStream.setPadChar(QChar(m_padChar));
+    formatStream.setRealNumberPrecision(m_realNumberPrecision);
+
+    formatStream << rhs;
+
+    m_fieldWidth          = formatStream.fieldWidth();
+    m_fieldAlignment      = formatStream.fieldAlignment();
+    m_padChar             = formatStream.padChar().unicode();
+    m_realNumberPrecision = formatStream.realNumberPrecision();
     return *this;
 }
 
 
 OStream &OStream::operator<<(uint64 rhs)
 {
-    *m_os << rhs;
+    char buf[24];
+    const char *num = formatDecimal(rhs, buf + sizeof(buf));
+
+    writeLatin1(num, static_cast<int>(buf + sizeof(buf) - num));
     return *this;
 }
 
 
 OStream &OStream::operator<<(int rhs)
 {
-    *m_os << rhs;
+    char buf[24];
+    const uint64 absValue = rhs < 0 ? -static_cast<uint64>(rhs) : static_cast<uint64>(rhs);
+    char *num             = formatDecimal(absValue, buf + sizeof(buf));
+
+    if (rhs < 0) {
+        *--num = '-';
+    }
+
+    writeLatin1(num, static_cast<int>(buf + sizeof(buf) - num));
     return *this;
 }
 
 
 OStream &OStream::operator<<(unsigned int rhs)
 {
-    *m_os << rhs;
-    return *this;
+    return *this << static_cast<uint64>(rhs);
 }
 
 
 OStream &OStream::operator<<(double rhs)
 {
-    *m_os << rhs;
+    // same format as QTextStream with default notation
+    const QByteArray num = QString::number(rhs, 'g', m_realNumberPrecision).toLatin1();
+
+    writeLatin1(num.constData(), num.size());
     return *this;
 }
 
 
 OStream &OStream::operator<<(const char *rhs)
 {
-    *m_os << rhs;
+    writeLatin1(rhs, static_cast<int>(std::strlen(rhs)));
     return *this;
 }
 
 
 OStream &OStream::operator<<(char rhs)
 {
-    *m_os << rhs;
+    writeLatin1(&rhs, 1);
+    return *this;
+}
+
+
+OStream &OStream::operator<<(const HexNumber &rhs)
+{
+    static const char digits[] = "0123456789abcdef";
+
+    char buf[24];
+    char *end           = buf + sizeof(buf);
+    char *num           = end;
+    uint64 value        = rhs.m_value;
+    const int minDigits = std::min<int>(rhs.m_minDigits, sizeof(buf));
+
+    do {
+        *--num = digits[value & 0xF];
+        value >>= 4;
+    } while (value != 0);
+
+    while (end - num < minDigits) {
+        *--num = '0';
+    }
+
+    writeLatin1(num, static_cast<int>(end - num));
     return *this;
 }
 
 
 void OStream::flush()
 {
-    m_os->flush();
+    flushBuffer();
+}
+
+
+void OStream::writeLatin1(const char *str, int len)
+{
+    writePadding(getPaddingBefore(len));
+
+    if (m_string) {
+        m_string->append(QLatin1String(str, len));
+    }
+    else {
+        for (int i = 0; i < len; i++) {
+            const unsigned char c = static_cast<unsigned char>(str[i]);
+
+            if (c < 0x80) {
+                m_buffer += static_cast<char>(c);
+            }
+            else {
+                m_buffer += static_cast<char>(0xC0 | (c >> 6));
+                m_buffer += static_cast<char>(0x80 | (c & 0x3F));
+            }
+        }
+    }
+
+    writePadding(getPaddingAfter(len));
+
+    if (m_buffer.size() > MAX_BUFFER_SIZE) {
+        flushBuffer();
+    }
+}
+
+
+void OStream::writePadding(int numPadding)
+{
+    if (numPadding <= 0) {
+        return;
+    }
+    else if (m_string) {
+        m_string->append(QString(numPadding, QChar(m_padChar)));
+    }
+    else if (m_padChar < 0x80) {
+        m_buffer.append(numPadding, static_cast<char>(m_padChar));
+    }
+    else {
+        const QByteArray utf8 = QString(numPadding, QChar(m_padChar)).toUtf8();
+        m_buffer.append(utf8.constData(), utf8.size());
+    }
+}
+
+
+int OStream::getPaddingBefore(int len) const
+{
+    const int numPadding = m_fieldWidth - len;
+    if (numPadding <= 0) {
+        return 0;
+    }
+
+    switch (m_fieldAlignment) {
+    case QTextStream::AlignLeft: return 0;
+    case QTextStream::AlignCenter: return numPadding / 2;
+    default: return numPadding;
+    }
+}
+
+
+int OStream::getPaddingAfter(int len) const
+{
+    const int numPadding = m_fieldWidth - len;
+    if (numPadding <= 0) {
+        return 0;
+    }
+
+    switch (m_fieldAlignment) {
+    case QTextStream::AlignLeft: return numPadding;
+    case QTextStream::AlignCenter: return numPadding - numPadding / 2;
+    default: return 0;
+    }
+}
+
+
+void OStream::flushBuffer()
+{
+    if (m_buffer.empty()) {
+        return;
+    }
+
+    if (m_device) {
+        m_device->write(m_buffer.data(), m_buffer.size());
+        m_device->flush();
+    }
+    else if (m_file) {
+        std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_file);
+        std::fflush(m_file);
+    }
+
+    m_buffer.clear();
 }
@@ -14,9 +14,11 @@
 #include "boomerang/util/Types.h"
 
 #include <cstdio>
+#include <string>
 
 
 class QFile;
+class QFileDevice;
 class QSaveFile;
 class QString;
 class QTextStream;
@@ -24,8 +26,33 @@ class QTextStreamManipulator;
 
 
 /**
- * Wrapper facade around QTextStream providing
- * only output functionality to a target.
+ * Writes an unsigned integer to an OStream as a lower case hexadecimal number
+ * without "0x" prefix, like QString::number(value, 16), but without creating
+ * a temporary string.
+ */
+struct BOOMERANG_API HexNumber
+{
+    /// \param minDigits If the number has fewer digits, it is padded with leading zeroes.
+    explicit HexNumber(uint64 value, int minDigits = 1)
+        : m_value(value)
+        , m_minDigits(minDigits)
+    {
+    }
+
+    uint64 m_value;
+    int m_minDigits;
+};
+
+
+/**
+ * Output stream to a target (string, file).
+ * The output is identical to the output of a QTextStream, but no QTextStream is created
+ * for each stream.
+ * All QTextStreamManipulators (qSetFieldWidth, qSetPadChar, qSetRealNumberPrecision)
+ * are supported; QTextStream functions like hex or endl cannot be streamed to an OStream.
+ * Strings are appended directly to string targets, so the target string is always
+ * up to date. Output to files is encoded as UTF-8 and buffered until the stream is flushed
+ * or destroyed.
  */
 class BOOMERANG_API OStream
 {
@@ -46,16 +73,48 @@ public:
 public:
     OStream &operator<<(const QString &rhs);
     OStream &operator<<(const QTextStreamManipulator &rhs);
+
+    /// QTextStream functions (hex, endl etc.) are not supported.
+    OStream &operator<<(QTextStream &(*rhs)(QTextStream &)) = delete;
+
     OStream &operator<<(uint64 rhs);
     OStream &operator<<(int rhs);
     OStream &operator<<(unsigned int rhs);
     OStream &operator<<(double rhs);
     OStream &operator<<(const char *rhs);
     OStream &operator<<(char rhs);
+    OStream &operator<<(const HexNumber &rhs);
 
     /// \copydoc QTextStream::flush
     void flush();
 
 private:
-    QTextStream *m_os;
+    /// Write \p len Latin-1 characters, padded to the current field width.
+    void writeLatin1(const char *str, int len);
+
+    /// Write \p numPadding pad characters.
+    void writePadding(int numPadding);
+
+    /// \returns the number of pad characters before a string of length \p len
+    int getPaddingBefore(int len) const;
+
+    /// \returns the number of pad characters after a string of length \p len
+    int getPaddingAfter(int len) const;
+
+    /// Write the buffered output to the target file.
+    void flushBuffer();
+
+private:
+    QString *m_string     = nullptr; ///< Target if writing to a string
+    QFileDevice *m_device = nullptr; ///< Target if writing to a QFile or QSaveFile
+    FILE *m_file          = nullptr; ///< Target if writing to a FILE
+
+    /// UTF-8 encoded output not yet written to the target file
+    std::string m_buffer;
+
+    // formatting set by QTextStream manipulators
+    int m_fieldWidth          = 0;
+    int m_fieldAlignment      = 1; ///< QTextStream::FieldAlignment (default: AlignRight)
+    uint16 m_padChar          = ' ';
+    int m_realNumberPrecision = 6;
 };
@@ -57,6 +57,8 @@ Log &Log::getOrCreateLog()
 
 void Log::flush()
 {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+
     for (std::unique_ptr<ILogSink> &s : m_sinks) {
         s->flush();
     }
@@ -97,6 +99,7 @@ void Log::logDirect(LogLevel level, const char *file, int line, const QString &m
 void Log::addLogSink(std::unique_ptr<ILogSink> s)
 {
     assert(s != nullptr);
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
 
     if (std::find(m_sinks.begin(), m_sinks.end(), s) == m_sinks.end()) {
         m_sinks.push_back(std::move(s));
@@ -119,6 +122,7 @@ void Log::removeAllSinks()
 {
     flush();
 
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
     m_sinks.clear();
 }
 
@@ -217,6 +221,8 @@ QString Log::collectArg(const QString &msg, const LocationSet *l)
 
 void Log::write(const QString &msg)
 {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+
     for (std::unique_ptr<ILogSink> &s : m_sinks) {
         s->write(msg);
     }
@@ -14,6 +14,7 @@
 #include "boomerang/util/Types.h"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 
@@ -195,6 +196,11 @@ private:
     size_t m_fileNameOffset;
     LogLevel m_level = LogLevel::Default;
     std::vector<std::unique_ptr<ILogSink>> m_sinks;
+
+    /// Serializes writing to, flushing and changing the sinks.
+    /// The GUI logs from the UI thread and from the decompiler thread,
+    /// and the C code generator logs from its worker threads.
+    std::mutex m_sinkMutex;
 };
 
 
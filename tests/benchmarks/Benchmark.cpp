@@ -0,0 +1,85 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+
+BenchmarkState::BenchmarkState(int iterations)
+    : m_iterations(iterations)
+{
+}
+
+
+bool BenchmarkState::keepRunning()
+{
+    if (isSkipped()) {
+        pauseTiming();
+        return false;
+    }
+
+    if (m_currentIteration < 0) {
+        m_currentIteration = 0;
+        resumeTiming();
+    }
+    else {
+        m_currentIteration++;
+    }
+
+    if (m_currentIteration >= m_iterations) {
+        pauseTiming();
+        return false;
+    }
+
+    return true;
+}
+
+
+void BenchmarkState::pauseTiming()
+{
+    if (m_timerRunning) {
+        m_elapsedNs += m_timer.nsecsElapsed();
+        m_timerRunning = false;
+    }
+}
+
+
+void BenchmarkState::resumeTiming()
+{
+    if (!m_timerRunning) {
+        m_timer.start();
+        m_timerRunning = true;
+    }
+}
+
+
+void BenchmarkState::skip(const QString &reason)
+{
+    m_skipReason = reason.isEmpty() ? QString("skipped") : reason;
+}
+
+
+BenchmarkRegistry &BenchmarkRegistry::get()
+{
+    static BenchmarkRegistry g_registry;
+    return g_registry;
+}
+
+
+void BenchmarkRegistry::registerBenchmark(const QString &name, int iterations,
+                                          BenchmarkFunction function)
+{
+    m_benchmarks.push_back({ name, iterations, function });
+}
+
+
+BenchmarkRegistrar::BenchmarkRegistrar(const char *name, int iterations,
+                                       BenchmarkFunction function)
+{
+    BenchmarkRegistry::get().registerBenchmark(name, iterations, function);
+}
@@ -0,0 +1,134 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include <QElapsedTimer>
+#include <QString>
+
+#include <vector>
+
+
+/**
+ * Timing state of a single benchmark run.
+ * The benchmark body is expected to look like this:
+ *
+ * \code
+ *     // untimed setup
+ *     while (state.keepRunning()) {
+ *         // timed code
+ *     }
+ * \endcode
+ */
+class BenchmarkState
+{
+public:
+    explicit BenchmarkState(int iterations);
+    BenchmarkState(const BenchmarkState &other) = delete;
+    BenchmarkState(BenchmarkState &&other)      = default;
+
+    ~BenchmarkState() = default;
+
+    BenchmarkState &operator=(const BenchmarkState &other) = delete;
+    BenchmarkState &operator=(BenchmarkState &&other) = default;
+
+public:
+    /**
+     * Starts the timer on the first call and counts one iteration on each subsequent call.
+     * \returns false after the requested number of iterations have been run.
+     */
+    bool keepRunning();
+
+    /// Stop the timer temporarily, e.g. to rebuild state that is consumed by the timed code.
+    void pauseTiming();
+
+    /// Restart the timer after \ref pauseTiming.
+    void resumeTiming();
+
+    /// Mark this benchmark as skipped, e.g. because a required plugin is not available.
+    void skip(const QString &reason);
+
+    /// Add \p items to the number of items (instructions, BBs, procs ...) processed by this run.
+    void addItemsProcessed(qint64 items) { m_items += items; }
+
+    /// Add \p bytes to the number of bytes processed by this run.
+    void addBytesProcessed(qint64 bytes) { m_bytes += bytes; }
+
+public:
+    int getIterations() const { return m_iterations; }
+    qint64 getElapsedNs() const { return m_elapsedNs; }
+    qint64 getItemsProcessed() const { return m_items; }
+    qint64 getBytesProcessed() const { return m_bytes; }
+
+    bool isSkipped() const { return !m_skipReason.isEmpty(); }
+    const QString &getSkipReason() const { return m_skipReason; }
+
+private:
+    int m_iterations;
+    int m_currentIteration = -1;
+    bool m_timerRunning    = false;
+    QElapsedTimer m_timer;
+    qint64 m_elapsedNs = 0;
+    qint64 m_items     = 0;
+    qint64 m_bytes     = 0;
+    QString m_skipReason;
+};
+
+
+typedef void (*BenchmarkFunction)(BenchmarkState &state);
+
+
+/// A benchmark registered via \ref BOOMERANG_BENCHMARK
+struct BenchmarkInfo
+{
+    QString name;
+    int iterations; ///< Number of timed iterations per repetition
+    BenchmarkFunction function;
+};
+
+
+/// Holds all benchmarks registered via \ref BOOMERANG_BENCHMARK
+class BenchmarkRegistry
+{
+public:
+    static BenchmarkRegistry &get();
+
+public:
+    void registerBenchmark(const QString &name, int iterations, BenchmarkFunction function);
+
+    const std::vector<BenchmarkInfo> &getBenchmarks() const { return m_benchmarks; }
+
+private:
+    std::vector<BenchmarkInfo> m_benchmarks;
+};
+
+
+/// Registers a benchmark at static initialization time.
+class BenchmarkRegistrar
+{
+public:
+    BenchmarkRegistrar(const char *name, int iterations, BenchmarkFunction function);
+};
+
+
+/**
+ * Defines and registers a benchmark. Usage:
+ *
+ * \code
+ *     BOOMERANG_BENCHMARK(DataFlow_calculateDominators, 10)
+ *     {
+ *         while (state.keepRunning()) { ... }
+ *     }
+ * \endcode
+ */
+#define BOOMERANG_BENCHMARK(name, iterations)                                                      \
+    static void benchmark_##name(BenchmarkState &state);                                           \
+    static BenchmarkRegistrar g_benchmarkRegistrar_##name(#name, iterations, &benchmark_##name);   \
+    static void benchmark_##name(BenchmarkState &state)
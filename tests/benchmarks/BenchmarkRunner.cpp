@@ -0,0 +1,277 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkRunner.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSysInfo>
+#include <QTextStream>
+#include <QThread>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+
+double BenchmarkResult::getMinNs() const
+{
+    return nsPerIteration.empty()
+               ? 0.0
+               : *std::min_element(nsPerIteration.begin(), nsPerIteration.end());
+}
+
+
+double BenchmarkResult::getMaxNs() const
+{
+    return nsPerIteration.empty()
+               ? 0.0
+               : *std::max_element(nsPerIteration.begin(), nsPerIteration.end());
+}
+
+
+double BenchmarkResult::getMeanNs() const
+{
+    if (nsPerIteration.empty()) {
+        return 0.0;
+    }
+
+    return std::accumulate(nsPerIteration.begin(), nsPerIteration.end(), 0.0) /
+           nsPerIteration.size();
+}
+
+
+double BenchmarkResult::getMedianNs() const
+{
+    if (nsPerIteration.empty()) {
+        return 0.0;
+    }
+
+    std::vector<double> sorted = nsPerIteration;
+    std::sort(sorted.begin(), sorted.end());
+
+    const size_t mid = sorted.size() / 2;
+    return (sorted.size() % 2 == 1) ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2.0;
+}
+
+
+double BenchmarkResult::getStdDevNs() const
+{
+    if (nsPerIteration.size() < 2) {
+        return 0.0;
+    }
+
+    const double mean = getMeanNs();
+    double sumSq      = 0.0;
+
+    for (double ns : nsPerIteration) {
+        sumSq += (ns - mean) * (ns - mean);
+    }
+
+    return std::sqrt(sumSq / (nsPerIteration.size() - 1));
+}
+
+
+QJsonObject BenchmarkResult::toJson() const
+{
+    QJsonObject obj;
+    obj["name"]        = name;
+    obj["iterations"]  = iterations;
+    obj["repetitions"] = repetitions;
+
+    if (isSkipped()) {
+        obj["skipped"]     = true;
+        obj["skip_reason"] = skipReason;
+        return obj;
+    }
+
+    const double median = getMedianNs();
+
+    obj["skipped"]     = false;
+    obj["time_unit"]   = QString("ns");
+    obj["real_time"]   = median;
+    obj["min_time"]    = getMinNs();
+    obj["max_time"]    = getMaxNs();
+    obj["mean_time"]   = getMeanNs();
+    obj["stddev_time"] = getStdDevNs();
+
+    QJsonArray samples;
+    for (double ns : nsPerIteration) {
+        samples.append(ns);
+    }
+    obj["samples"] = samples;
+
+    if (itemsPerIteration > 0.0 && median > 0.0) {
+        obj["items_per_iteration"] = itemsPerIteration;
+        obj["items_per_second"]    = itemsPerIteration * 1e9 / median;
+    }
+
+    if (bytesPerIteration > 0.0 && median > 0.0) {
+        obj["bytes_per_iteration"] = bytesPerIteration;
+        obj["bytes_per_second"]    = bytesPerIteration * 1e9 / median;
+    }
+
+    return obj;
+}
+
+
+BenchmarkRunner::BenchmarkRunner()
+    : m_filter(".*")
+{
+}
+
+
+void BenchmarkRunner::setRepetitions(int repetitions)
+{
+    m_repetitions = std::max(1, repetitions);
+}
+
+
+QStringList BenchmarkRunner::getMatchingBenchmarks() const
+{
+    QStringList names;
+
+    for (const BenchmarkInfo &info : BenchmarkRegistry::get().getBenchmarks()) {
+        if (m_filter.match(info.name).hasMatch()) {
+            names.append(info.name);
+        }
+    }
+
+    return names;
+}
+
+
+int BenchmarkRunner::runAll()
+{
+    m_results.clear();
+
+    std::vector<BenchmarkInfo> benchmarks = BenchmarkRegistry::get().getBenchmarks();
+    std::sort(benchmarks.begin(), benchmarks.end(),
+              [](const BenchmarkInfo &a, const BenchmarkInfo &b) { return a.name < b.name; });
+
+    int numRun = 0;
+
+    for (const BenchmarkInfo &info : benchmarks) {
+        if (!m_filter.match(info.name).hasMatch()) {
+            continue;
+        }
+
+        m_results.push_back(runBenchmark(info));
+        printResult(m_results.back());
+
+        if (!m_results.back().isSkipped()) {
+            numRun++;
+        }
+    }
+
+    return numRun;
+}
+
+
+BenchmarkResult BenchmarkRunner::runBenchmark(const BenchmarkInfo &info)
+{
+    BenchmarkResult result;
+    result.name        = info.name;
+    result.iterations  = info.iterations;
+    result.repetitions = m_repetitions;
+
+    if (m_warmup) {
+        BenchmarkState warmupState(1);
+        info.function(warmupState);
+
+        if (warmupState.isSkipped()) {
+            result.skipReason = warmupState.getSkipReason();
+            return result;
+        }
+    }
+
+    for (int rep = 0; rep < m_repetitions; rep++) {
+        BenchmarkState state(info.iterations);
+        info.function(state);
+
+        if (state.isSkipped()) {
+            result.skipReason = state.getSkipReason();
+            result.nsPerIteration.clear();
+            return result;
+        }
+
+        const int iterations = std::max(1, state.getIterations());
+        result.nsPerIteration.push_back(static_cast<double>(state.getElapsedNs()) / iterations);
+        result.itemsPerIteration = static_cast<double>(state.getItemsProcessed()) / iterations;
+        result.bytesPerIteration = static_cast<double>(state.getBytesProcessed()) / iterations;
+    }
+
+    return result;
+}
+
+
+void BenchmarkRunner::printResult(const BenchmarkResult &result) const
+{
+    QTextStream out(stdout);
+
+    out << result.name.leftJustified(50);
+
+    if (result.isSkipped()) {
+        out << "SKIPPED (" << result.skipReason << ")\n";
+        out.flush();
+        return;
+    }
+
+    const double median = result.getMedianNs();
+
+    out << QString::number(median / 1e6, 'f', 3).rightJustified(14) << " ms/iter";
+    out << "  (+/- " << QString::number(result.getStdDevNs() / 1e6, 'f', 3) << " ms)";
+
+    if (result.itemsPerIteration > 0.0 && median > 0.0) {
+        out << "  " << QString::number(result.itemsPerIteration * 1e9 / median, 'f', 0)
+            << " items/s";
+    }
+
+    if (result.bytesPerIteration > 0.0 && median > 0.0) {
+        out << "  " << QString::number(result.bytesPerIteration * 1e3 / median, 'f', 2)
+            << " MB/s";
+    }
+
+    out << "\n";
+    out.flush();
+}
+
+
+bool BenchmarkRunner::writeJson(const QString &filePath) const
+{
+    QJsonObject context;
+    context["date"]        = QDateTime::currentDateTime().toString(Qt::ISODate);
+    context["host_name"]   = QSysInfo::machineHostName();
+    context["os"]          = QSysInfo::prettyProductName();
+    context["cpu_arch"]    = QSysInfo::currentCpuArchitecture();
+    context["num_cpus"]    = QThread::idealThreadCount();
+    context["version"]     = QString(BOOMERANG_VERSION);
+    context["build_type"]  = QString(BOOMERANG_BENCHMARK_BUILD_TYPE);
+    context["repetitions"] = m_repetitions;
+    context["warmup"]      = m_warmup;
+
+    QJsonArray benchmarks;
+    for (const BenchmarkResult &result : m_results) {
+        benchmarks.append(result.toJson());
+    }
+
+    QJsonObject root;
+    root["context"]    = context;
+    root["benchmarks"] = benchmarks;
+
+    QFile outFile(filePath);
+    if (!outFile.open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+
+    outFile.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    return true;
+}
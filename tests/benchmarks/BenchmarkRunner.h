@@ -0,0 +1,99 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "Benchmark.h"
+
+#include <QJsonObject>
+#include <QRegularExpression>
+
+#include <vector>
+
+
+/// Result of all repetitions of a single benchmark.
+struct BenchmarkResult
+{
+    QString name;
+    int iterations  = 0;
+    int repetitions = 0;
+
+    /// Wall clock time per iteration, one sample per repetition
+    std::vector<double> nsPerIteration;
+
+    double itemsPerIteration = 0.0;
+    double bytesPerIteration = 0.0;
+
+    QString skipReason;
+
+public:
+    bool isSkipped() const { return !skipReason.isEmpty(); }
+
+    double getMinNs() const;
+    double getMaxNs() const;
+    double getMeanNs() const;
+    double getMedianNs() const;
+    double getStdDevNs() const;
+
+    QJsonObject toJson() const;
+};
+
+
+/**
+ * Runs the benchmarks registered in the \ref BenchmarkRegistry
+ * and reports the results to stdout and (optionally) to a JSON file.
+ */
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner();
+    BenchmarkRunner(const BenchmarkRunner &other) = delete;
+    BenchmarkRunner(BenchmarkRunner &&other)      = default;
+
+    ~BenchmarkRunner() = default;
+
+    BenchmarkRunner &operator=(const BenchmarkRunner &other) = delete;
+    BenchmarkRunner &operator=(BenchmarkRunner &&other) = default;
+
+public:
+    /// Only run benchmarks whose name matches \p filter.
+    void setFilter(const QRegularExpression &filter) { m_filter = filter; }
+
+    /// Set the number of timed repetitions of each benchmark (at least 1).
+    void setRepetitions(int repetitions);
+
+    /// Run each benchmark once without recording the result before timing it.
+    void setWarmup(bool warmup) { m_warmup = warmup; }
+
+    /// \returns the names of all benchmarks matching the current filter.
+    QStringList getMatchingBenchmarks() const;
+
+    /**
+     * Run all benchmarks matching the current filter.
+     * \returns the number of benchmarks that were run (not counting skipped ones).
+     */
+    int runAll();
+
+    /**
+     * Write the results of the last \ref runAll to \p filePath.
+     * \returns true on success.
+     */
+    bool writeJson(const QString &filePath) const;
+
+private:
+    BenchmarkResult runBenchmark(const BenchmarkInfo &info);
+    void printResult(const BenchmarkResult &result) const;
+
+private:
+    QRegularExpression m_filter;
+    int m_repetitions = 5;
+    bool m_warmup     = true;
+    std::vector<BenchmarkResult> m_results;
+};
@@ -0,0 +1,190 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkUtils.h"
+
+#include "Benchmark.h"
+
+#include "boomerang/core/Settings.h"
+#include "boomerang/db/BasicBlock.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/module/Module.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/passes/PassManager.h"
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/type/IntegerType.h"
+
+#include <algorithm>
+#include <random>
+
+
+BenchmarkProject::BenchmarkProject()
+{
+    getSettings()->setDataDirectory(BOOMERANG_BENCHMARK_BASE "share/boomerang/");
+    getSettings()->setPluginDirectory(BOOMERANG_BENCHMARK_BASE "lib/boomerang/plugins/");
+
+    if (m_outputDir.isValid()) {
+        getSettings()->setOutputDirectory(m_outputDir.path());
+    }
+}
+
+
+Project *getBenchmarkProject()
+{
+    static std::unique_ptr<BenchmarkProject> g_project;
+
+    if (!g_project) {
+        g_project.reset(new BenchmarkProject);
+        g_project->loadPlugins();
+    }
+
+    return g_project.get();
+}
+
+
+QString getFullSamplePath(const QString &relpath)
+{
+    return QString(BOOMERANG_BENCHMARK_BASE) + "share/boomerang/samples/" + relpath;
+}
+
+
+bool loadSample(BenchmarkState &state, const QString &relpath, bool decode)
+{
+    Project *project = getBenchmarkProject();
+
+    if (!project->loadBinaryFile(getFullSamplePath(relpath))) {
+        state.skip(QString("Could not load sample '%1'").arg(relpath));
+        return false;
+    }
+    else if (!project->getProg()->getFrontEnd()) {
+        state.skip(QString("No frontend for sample '%1'").arg(relpath));
+        return false;
+    }
+    else if (decode && !project->decodeBinaryFile()) {
+        state.skip(QString("Could not decode sample '%1'").arg(relpath));
+        return false;
+    }
+
+    return true;
+}
+
+
+std::vector<UserProc *> getDecodedUserProcs(Prog *prog)
+{
+    std::vector<UserProc *> procs;
+
+    for (const auto &module : prog->getModuleList()) {
+        for (Function *func : *module) {
+            if (func->isLib()) {
+                continue;
+            }
+
+            UserProc *proc = static_cast<UserProc *>(func);
+            if (proc->isDecoded()) {
+                procs.push_back(proc);
+            }
+        }
+    }
+
+    return procs;
+}
+
+
+void runPassesUntilPropagation(UserProc *proc)
+{
+    PassManager::get()->executePass(PassID::StatementInit, proc);
+    PassManager::get()->executePass(PassID::BBSimplify, proc);
+    PassManager::get()->executePass(PassID::Dominators, proc);
+    PassManager::get()->executePass(PassID::CallDefineUpdate, proc);
+    PassManager::get()->executePass(PassID::GlobalConstReplace, proc);
+    PassManager::get()->executePass(PassID::PhiPlacement, proc);
+    PassManager::get()->executePass(PassID::BlockVarRename, proc);
+}
+
+
+std::unique_ptr<UserProc> createSyntheticProc(Prog *prog, int numBBs, int stmtsPerBB,
+                                              unsigned int seed)
+{
+    // Use the raw generator output instead of std::uniform_int_distribution
+    // since the latter is implementation defined and would make results
+    // incomparable between standard libraries.
+    std::minstd_rand rng(seed);
+
+    const Address baseAddr = Address(0x10000);
+    const int bbSize       = std::max(1, stmtsPerBB);
+    const int maxJump      = 32;
+    const RegNum firstReg  = 24;
+    const int numRegs      = 8;
+
+    std::unique_ptr<UserProc> proc(new UserProc(baseAddr, "synthetic", prog->getRootModule()));
+    ProcCFG *cfg = proc->getCFG();
+
+    // successors[i] is the list of out edge targets of BB i
+    std::vector<std::vector<int>> successors(numBBs);
+
+    for (int i = 0; i < numBBs - 1; i++) {
+        successors[i].push_back(i + 1);
+
+        if (rng() % 3 != 0 || i + 2 >= numBBs) {
+            continue;
+        }
+
+        if (rng() % 4 == 0) {
+            // loop back edge
+            const int lowest = std::max(0, i - maxJump);
+            successors[i].push_back(lowest + static_cast<int>(rng() % (i - lowest + 1)));
+        }
+        else {
+            // forward branch, skipping at least one BB
+            const int highest = std::min(numBBs - 1, i + maxJump);
+            successors[i].push_back(i + 2 + static_cast<int>(rng() % (highest - i - 1)));
+        }
+    }
+
+    std::vector<BasicBlock *> bbs(numBBs, nullptr);
+
+    for (int i = 0; i < numBBs; i++) {
+        std::unique_ptr<RTLList> rtls(new RTLList);
+
+        for (int j = 0; j < bbSize; j++) {
+            const Address addr = baseAddr + i * bbSize + j;
+            const RegNum lhs   = firstReg + static_cast<RegNum>(rng() % numRegs);
+            const RegNum rhs   = firstReg + static_cast<RegNum>(rng() % numRegs);
+
+            rtls->push_back(std::unique_ptr<RTL>(
+                new RTL(addr, { new Assign(IntegerType::get(32), Location::regOf(lhs),
+                                           Binary::get(opPlus, Location::regOf(rhs),
+                                                       Const::get(i))) })));
+        }
+
+        BBType bbType = BBType::Ret;
+        if (successors[i].size() == 2) {
+            bbType = BBType::Twoway;
+        }
+        else if (successors[i].size() == 1) {
+            bbType = BBType::Fall;
+        }
+
+        bbs[i] = cfg->createBB(bbType, std::move(rtls));
+    }
+
+    for (int i = 0; i < numBBs; i++) {
+        for (int succ : successors[i]) {
+            cfg->addEdge(bbs[i], bbs[succ]);
+        }
+    }
+
+    proc->setEntryBB();
+    return proc;
+}
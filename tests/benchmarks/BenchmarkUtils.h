@@ -0,0 +1,77 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/Project.h"
+
+#include <QTemporaryDir>
+
+#include <memory>
+#include <vector>
+
+
+class BenchmarkState;
+class Prog;
+class UserProc;
+
+
+/**
+ * Project with data and plugin directories set up relative to the build output directory.
+ * Generated code is written to a temporary directory that is removed on destruction.
+ */
+class BenchmarkProject : public Project
+{
+public:
+    BenchmarkProject();
+
+private:
+    QTemporaryDir m_outputDir;
+};
+
+
+/**
+ * \returns the project shared by all benchmarks.
+ * Plugins are process wide singletons, so they are loaded only once, on first use.
+ */
+Project *getBenchmarkProject();
+
+/// \returns the full absolute path given a path relative to the data/samples/ directory
+QString getFullSamplePath(const QString &relpath);
+
+/**
+ * Load the sample binary \p relpath into the shared project,
+ * and optionally decode it. If this fails, \p state is marked as skipped.
+ * \returns true on success.
+ */
+bool loadSample(BenchmarkState &state, const QString &relpath, bool decode);
+
+/// \returns all decoded procedures of \p prog that are not library procedures.
+std::vector<UserProc *> getDecodedUserProcs(Prog *prog);
+
+/**
+ * Run the passes of the early decompilation stage on \p proc, up to (but not including)
+ * statement propagation. This yields a procedure in SSA form.
+ */
+void runPassesUntilPropagation(UserProc *proc);
+
+/**
+ * Create a procedure with a reproducible, randomly generated CFG.
+ * The BBs are laid out sequentially and connected by fallthrough edges;
+ * additionally, about a third of the BBs get a forward branch or a loop back edge.
+ * Each BB contains \p stmtsPerBB register assignments.
+ *
+ * \param prog       the program the procedure belongs to.
+ * \param numBBs     number of BBs of the CFG (at least 1).
+ * \param stmtsPerBB number of assignments per BB.
+ * \param seed       seed of the pseudo random number generator.
+ */
+std::unique_ptr<UserProc> createSyntheticProc(Prog *prog, int numBBs, int stmtsPerBB,
+                                              unsigned int seed);
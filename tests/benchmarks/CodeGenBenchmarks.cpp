@@ -0,0 +1,83 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+#include "BenchmarkUtils.h"
+
+#include "boomerang/core/plugin/Plugin.h"
+#include "boomerang/core/plugin/PluginManager.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ifc/ICodeGenerator.h"
+#include "boomerang/ssl/statements/Statement.h"
+
+
+static void benchmarkCCodeGenerator(BenchmarkState &state, const QString &relpath)
+{
+    Project *project = getBenchmarkProject();
+    Plugin *plugin   = project->getPluginManager()->getPluginByName("C Code Generator plugin");
+
+    if (!plugin) {
+        state.skip("C code generator plugin not available");
+        return;
+    }
+    else if (!loadSample(state, relpath, true)) {
+        return;
+    }
+    else if (!project->decompileBinaryFile()) {
+        state.skip(QString("Could not decompile sample '%1'").arg(relpath));
+        return;
+    }
+
+    ICodeGenerator *gen   = plugin->getIfc<ICodeGenerator>();
+    Prog *prog            = project->getProg();
+    const size_t numProcs = getDecodedUserProcs(prog).size();
+
+    while (state.keepRunning()) {
+        gen->generateCode(prog);
+        state.addItemsProcessed(numProcs);
+    }
+}
+
+
+/// Print all statements of a procedure to strings, like logging them in verbose mode does.
+static void benchmarkPrintStatements(BenchmarkState &state, int numBBs)
+{
+    Prog prog("synthetic", getBenchmarkProject());
+    std::unique_ptr<UserProc> proc = createSyntheticProc(&prog, numBBs, 8, 42);
+
+    const std::vector<Statement *> &stmts = proc->getCFG()->getStatements();
+
+    while (state.keepRunning()) {
+        for (const Statement *stmt : stmts) {
+            state.addBytesProcessed(stmt->toString().length());
+        }
+
+        state.addItemsProcessed(stmts.size());
+    }
+}
+
+
+BOOMERANG_BENCHMARK(CCodeGenerator_pentium_encrypt, 10)
+{
+    benchmarkCCodeGenerator(state, "pentium/encrypt");
+}
+
+
+BOOMERANG_BENCHMARK(CCodeGenerator_pentium_nestedswitch, 10)
+{
+    benchmarkCCodeGenerator(state, "pentium/nestedswitch");
+}
+
+
+BOOMERANG_BENCHMARK(Statement_print_synthetic_10k, 10)
+{
+    benchmarkPrintStatements(state, 10000);
+}
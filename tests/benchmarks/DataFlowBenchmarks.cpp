@@ -0,0 +1,110 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+#include "BenchmarkUtils.h"
+
+#include "boomerang/db/DataFlow.h"
+#include "boomerang/db/DefCollector.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/statements/Assign.h"
+
+
+static void benchmarkDominators(BenchmarkState &state, int numBBs)
+{
+    Prog prog("synthetic", getBenchmarkProject());
+    std::unique_ptr<UserProc> proc = createSyntheticProc(&prog, numBBs, 2, 42);
+
+    while (state.keepRunning()) {
+        proc->getDataFlow()->calculateDominators();
+        state.addItemsProcessed(numBBs);
+    }
+}
+
+
+static void benchmarkPhiPlacement(BenchmarkState &state, int numBBs)
+{
+    Prog prog("synthetic", getBenchmarkProject());
+
+    while (state.keepRunning()) {
+        // placing phi functions modifies the CFG, so start from scratch every time
+        state.pauseTiming();
+        std::unique_ptr<UserProc> proc = createSyntheticProc(&prog, numBBs, 4, 42);
+        proc->getDataFlow()->calculateDominators();
+        state.resumeTiming();
+
+        proc->getDataFlow()->placePhiFunctions();
+        state.addItemsProcessed(numBBs);
+
+        state.pauseTiming();
+        proc.reset();
+        state.resumeTiming();
+    }
+}
+
+
+/// Collect the reaching definitions of \p numLocs locations at a call, like renaming does.
+static void benchmarkDefCollector(BenchmarkState &state, int numLocs)
+{
+    std::map<SharedExp, std::deque<Statement *>, lessExpStar> stacks;
+    std::vector<std::unique_ptr<Assign>> defs;
+
+    for (int i = 0; i < numLocs; i++) {
+        SharedExp loc = Location::memOf(
+            Binary::get(opPlus, Location::regOf(28), Const::get(4 * i)));
+
+        defs.emplace_back(new Assign(loc->clone(), Const::get(i)));
+        stacks[loc].push_back(defs.back().get());
+    }
+
+    while (state.keepRunning()) {
+        DefCollector col;
+        col.updateDefs(stacks, nullptr);
+
+        for (auto &stack : stacks) {
+            col.findDefFor(stack.first);
+        }
+
+        state.addItemsProcessed(numLocs);
+    }
+}
+
+
+BOOMERANG_BENCHMARK(DataFlow_calculateDominators_synthetic_1k, 50)
+{
+    benchmarkDominators(state, 1000);
+}
+
+
+BOOMERANG_BENCHMARK(DataFlow_calculateDominators_synthetic_50k, 5)
+{
+    benchmarkDominators(state, 50000);
+}
+
+
+BOOMERANG_BENCHMARK(DataFlow_placePhiFunctions_synthetic_1k, 20)
+{
+    benchmarkPhiPlacement(state, 1000);
+}
+
+
+BOOMERANG_BENCHMARK(DataFlow_placePhiFunctions_synthetic_20k, 3)
+{
+    benchmarkPhiPlacement(state, 20000);
+}
+
+
+BOOMERANG_BENCHMARK(DataFlow_DefCollector_updateDefs_1k, 20)
+{
+    benchmarkDefCollector(state, 1000);
+}
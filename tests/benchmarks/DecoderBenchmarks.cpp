@@ -0,0 +1,153 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+#include "BenchmarkUtils.h"
+
+#include "boomerang/core/plugin/Plugin.h"
+#include "boomerang/core/plugin/PluginManager.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/binary/BinaryFile.h"
+#include "boomerang/db/binary/BinaryImage.h"
+#include "boomerang/db/binary/BinarySection.h"
+#include "boomerang/frontend/DecodeResult.h"
+#include "boomerang/ifc/IDecoder.h"
+#include "boomerang/ifc/IFrontEnd.h"
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+
+/**
+ * Decode all bytes in [start, end) linearly, i.e. without following control flow.
+ * Invalid instructions are skipped by advancing \p stride bytes.
+ */
+static void decodeLinear(BenchmarkState &state, IDecoder *decoder, Address start, Address end,
+                         ptrdiff_t delta, int stride)
+{
+    DecodeResult result;
+    Address pc = start;
+
+    while (pc < end) {
+        bool valid = false;
+
+        try {
+            valid = decoder->decodeInstruction(pc, delta, result);
+        }
+        catch (const std::runtime_error &) {
+            valid = false;
+        }
+
+        if (valid && result.numBytes > 0) {
+            state.addItemsProcessed(1);
+            state.addBytesProcessed(result.numBytes);
+            pc += result.numBytes;
+        }
+        else {
+            pc += stride;
+        }
+    }
+}
+
+
+/// Decode the .text section of sample binary \p relpath linearly.
+static void benchmarkSampleDecoder(BenchmarkState &state, const QString &relpath, int stride)
+{
+    if (!loadSample(state, relpath, false)) {
+        return;
+    }
+
+    Prog *prog                    = getBenchmarkProject()->getProg();
+    IDecoder *decoder             = prog->getFrontEnd()->getDecoder();
+    const BinarySection *textSect = prog->getBinaryFile()->getImage()->getSectionByName(".text");
+
+    if (!decoder) {
+        state.skip("No decoder available");
+        return;
+    }
+    else if (!textSect || textSect->getHostAddr() == HostAddress::INVALID) {
+        state.skip(QString("Sample '%1' does not have a .text section").arg(relpath));
+        return;
+    }
+
+    const Address start   = textSect->getSourceAddr();
+    const Address end     = start + textSect->getSize();
+    const ptrdiff_t delta = (textSect->getHostAddr() - textSect->getSourceAddr()).value();
+
+    while (state.keepRunning()) {
+        decodeLinear(state, decoder, start, end, delta, stride);
+    }
+}
+
+
+BOOMERANG_BENCHMARK(Decoder_CapstoneX86_hello_clang4_static, 5)
+{
+    benchmarkSampleDecoder(state, "elf/hello-clang4-static", 1);
+}
+
+
+BOOMERANG_BENCHMARK(Decoder_SPARC_ass3_SunOS, 5)
+{
+    benchmarkSampleDecoder(state, "sparc/ass3.SunOS", 4);
+}
+
+
+BOOMERANG_BENCHMARK(Decoder_PPC_switch, 50)
+{
+    benchmarkSampleDecoder(state, "elf32-ppc/switch", 4);
+}
+
+
+BOOMERANG_BENCHMARK(Decoder_ST20_synthetic_64k, 5)
+{
+    // There are no ST20 sample binaries, so decode a synthetic instruction stream.
+    // We still need a loaded program since the decoder refers to the program settings.
+    if (!loadSample(state, "pentium/hello", false)) {
+        return;
+    }
+
+    Project *project = getBenchmarkProject();
+    Plugin *plugin   = project->getPluginManager()->getPluginByName("ST20 decoder plugin");
+    if (!plugin) {
+        state.skip("ST20 decoder plugin not available");
+        return;
+    }
+
+    IDecoder *decoder = plugin->getIfc<IDecoder>();
+    if (!decoder || !decoder->initialize(project)) {
+        state.skip("Could not initialize ST20 decoder");
+        return;
+    }
+
+    // Direct function codes that instantiate a single RTL,
+    // optionally preceded by a prefix (pfix, function code 2)
+    const unsigned char functionCodes[] = { 0x1, 0x3, 0x4, 0x5, 0x7, 0x8, 0xB, 0xC, 0xD, 0xE };
+    const int numFunctionCodes          = sizeof(functionCodes) / sizeof(*functionCodes);
+
+    std::minstd_rand rng(0xB00);
+    std::vector<unsigned char> code;
+    code.reserve(64 * 1024);
+
+    while (code.size() < 64 * 1024 - 1) {
+        if (rng() % 4 == 0) {
+            code.push_back(0x20 | (rng() % 16));
+        }
+
+        code.push_back((functionCodes[rng() % numFunctionCodes] << 4) | (rng() % 16));
+    }
+
+    const Address start   = Address(0x1000);
+    const Address end     = start + code.size();
+    const ptrdiff_t delta = (HostAddress(code.data()) - start).value();
+
+    while (state.keepRunning()) {
+        decodeLinear(state, decoder, start, end, delta, 1);
+    }
+}
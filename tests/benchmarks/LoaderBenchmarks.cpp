@@ -0,0 +1,152 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+#include "BenchmarkUtils.h"
+
+#include "boomerang/util/ByteUtil.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <algorithm>
+#include <vector>
+
+
+/**
+ * Create a big endian 32 bit SPARC ELF executable with a single .text section
+ * and a .rela.text section with \p numRelocs relocations.
+ */
+static QByteArray createBigEndianElf(int numRelocs)
+{
+    const char shStrings[] = "\0.shstrtab\0.text\0.rela.text";
+    const DWord ehdrSize   = 52;
+    const DWord shdrSize   = 40;
+    const DWord relaSize   = 12;
+    const DWord textSize   = 0x1000;
+    const DWord textAddr   = 0x10000;
+    const int numSections  = 4;
+
+    const DWord strOffset  = ehdrSize;
+    const DWord textOffset = (strOffset + sizeof(shStrings) + 3) & ~3U;
+    const DWord relaOffset = textOffset + textSize;
+    const DWord shOffset   = relaOffset + numRelocs * relaSize;
+
+    QByteArray data(shOffset + numSections * shdrSize, '\0');
+    Byte *img = reinterpret_cast<Byte *>(data.data());
+
+    // ELF header
+    const Byte ident[] = { 0x7F, 'E', 'L', 'F', 1 /* 32 bit */, 2 /* MSB */, 1 /* version */ };
+    std::copy(std::begin(ident), std::end(ident), img);
+    Util::writeWord(img + 16, 2, Endian::Big);           // e_type = ET_EXEC
+    Util::writeWord(img + 18, 2, Endian::Big);           // e_machine = EM_SPARC
+    Util::writeDWord(img + 20, 1, Endian::Big);          // e_version
+    Util::writeDWord(img + 24, textAddr, Endian::Big);   // e_entry
+    Util::writeDWord(img + 28, ehdrSize, Endian::Big);   // e_phoff (no program headers)
+    Util::writeDWord(img + 32, shOffset, Endian::Big);   // e_shoff
+    Util::writeWord(img + 40, ehdrSize, Endian::Big);    // e_ehsize
+    Util::writeWord(img + 42, 32, Endian::Big);          // e_phentsize
+    Util::writeWord(img + 46, shdrSize, Endian::Big);    // e_shentsize
+    Util::writeWord(img + 48, numSections, Endian::Big); // e_shnum
+    Util::writeWord(img + 50, 1, Endian::Big);           // e_shstrndx
+
+    std::copy(std::begin(shStrings), std::end(shStrings), img + strOffset);
+
+    // R_SPARC_NONE relocations without symbol
+    for (int i = 0; i < numRelocs; i++) {
+        Util::writeDWord(img + relaOffset + i * relaSize, textAddr + 4 * (i % (textSize / 4)),
+                         Endian::Big);
+    }
+
+    auto writeShdr = [&](int idx, DWord name, DWord type, DWord flags, DWord addr, DWord offset,
+                         DWord size, DWord entSize) {
+        const DWord fields[] = { name, type, flags, addr, offset, size, 0, 0, 4, entSize };
+        for (std::size_t f = 0; f < sizeof(fields) / sizeof(DWord); f++) {
+            Util::writeDWord(img + shOffset + idx * shdrSize + 4 * f, fields[f], Endian::Big);
+        }
+    };
+
+    writeShdr(1, 1, 3 /* SHT_STRTAB */, 0, 0, strOffset, sizeof(shStrings), 0);
+    writeShdr(2, 11, 1 /* SHT_PROGBITS */, 6 /* SHF_ALLOC | SHF_EXECINSTR */, textAddr,
+              textOffset, textSize, 0);
+    writeShdr(3, 17, 4 /* SHT_RELA */, 0, 0, relaOffset, numRelocs * relaSize, relaSize);
+
+    return data;
+}
+
+
+static void benchmarkBigEndianElfLoader(BenchmarkState &state, int numRelocs)
+{
+    QTemporaryDir dir;
+    const QString path = dir.filePath("big-endian.elf");
+
+    QFile file(path);
+    if (!dir.isValid() || !file.open(QFile::WriteOnly)) {
+        state.skip("Could not create temporary ELF file");
+        return;
+    }
+
+    const QByteArray elf = createBigEndianElf(numRelocs);
+    file.write(elf);
+    file.close();
+
+    while (state.keepRunning()) {
+        if (!getBenchmarkProject()->loadBinaryFile(path)) {
+            state.skip("Could not load synthetic ELF file");
+            return;
+        }
+
+        state.addItemsProcessed(numRelocs);
+        state.addBytesProcessed(elf.size());
+    }
+}
+
+
+/// Read a table of \p numWords big endian words, either one by one or all at once.
+static void benchmarkReadDWords(BenchmarkState &state, int numWords, bool bulk)
+{
+    std::vector<Byte> src(4 * numWords);
+    for (std::size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<Byte>(i);
+    }
+
+    std::vector<DWord> dst(numWords);
+
+    while (state.keepRunning()) {
+        if (bulk) {
+            Util::readDWords(dst.data(), src.data(), numWords, Endian::Big);
+        }
+        else {
+            for (int i = 0; i < numWords; i++) {
+                dst[i] = Util::readDWord(src.data() + 4 * i, Endian::Big);
+            }
+        }
+
+        state.addBytesProcessed(src.size());
+    }
+}
+
+
+BOOMERANG_BENCHMARK(ElfBinaryLoader_bigEndian_synthetic_500k, 5)
+{
+    benchmarkBigEndianElfLoader(state, 500000);
+}
+
+
+BOOMERANG_BENCHMARK(ByteUtil_readDWord_bigEndian_1M, 20)
+{
+    benchmarkReadDWords(state, 1 << 20, false);
+}
+
+
+BOOMERANG_BENCHMARK(ByteUtil_readDWords_bigEndian_1M, 20)
+{
+    benchmarkReadDWords(state, 1 << 20, true);
+}
@@ -0,0 +1,96 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BenchmarkRunner.h"
+
+#include "boomerang/util/log/ConsoleLogSink.h"
+#include "boomerang/util/log/Log.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QTextStream>
+
+#include <memory>
+
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("boomerang-benchmarks");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Boomerang microbenchmarks");
+    parser.addHelpOption();
+
+    QCommandLineOption filterOption(QStringList() << "f" << "filter",
+                                    "Only run benchmarks matching the regular expression <regex>.",
+                                    "regex", ".*");
+    QCommandLineOption repetitionsOption(QStringList() << "r" << "repetitions",
+                                         "Number of timed repetitions per benchmark (default: 5).",
+                                         "n", "5");
+    QCommandLineOption jsonOption(QStringList() << "o" << "json",
+                                  "Write the results in JSON format to <file>.", "file");
+    QCommandLineOption listOption(QStringList() << "l" << "list",
+                                  "List all benchmarks matching the filter and exit.");
+    QCommandLineOption noWarmupOption("no-warmup", "Do not run a warmup iteration.");
+    QCommandLineOption verboseOption(QStringList() << "v" << "verbose",
+                                     "Print warnings and messages of the decompiler.");
+
+    parser.addOption(filterOption);
+    parser.addOption(repetitionsOption);
+    parser.addOption(jsonOption);
+    parser.addOption(listOption);
+    parser.addOption(noWarmupOption);
+    parser.addOption(verboseOption);
+    parser.process(app);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    const QRegularExpression filter(parser.value(filterOption));
+    if (!filter.isValid()) {
+        err << "Invalid filter: " << filter.errorString() << "\n";
+        return 1;
+    }
+
+    bool repetitionsOk    = false;
+    const int repetitions = parser.value(repetitionsOption).toInt(&repetitionsOk);
+    if (!repetitionsOk || repetitions < 1) {
+        err << "Invalid number of repetitions: " << parser.value(repetitionsOption) << "\n";
+        return 1;
+    }
+
+    BenchmarkRunner runner;
+    runner.setFilter(filter);
+    runner.setRepetitions(repetitions);
+    runner.setWarmup(!parser.isSet(noWarmupOption));
+
+    if (parser.isSet(listOption)) {
+        for (const QString &name : runner.getMatchingBenchmarks()) {
+            out << name << "\n";
+        }
+
+        return 0;
+    }
+
+    Log::getOrCreateLog().addLogSink(std::make_unique<ConsoleLogSink>());
+    Log::getOrCreateLog().setLogLevel(parser.isSet(verboseOption) ? LogLevel::Default
+                                                                  : LogLevel::Error);
+
+    runner.runAll();
+
+    if (parser.isSet(jsonOption)) {
+        if (!runner.writeJson(parser.value(jsonOption))) {
+            err << "Could not write results to '" << parser.value(jsonOption) << "'\n";
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+#include "BenchmarkUtils.h"
+
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/passes/PassManager.h"
+
+
+static void benchmarkBlockVarRename(BenchmarkState &state, const QString &relpath)
+{
+    while (state.keepRunning()) {
+        // Renaming modifies the procedures, so reload the binary every time
+        state.pauseTiming();
+        if (!loadSample(state, relpath, true)) {
+            return;
+        }
+
+        const std::vector<UserProc *> procs = getDecodedUserProcs(getBenchmarkProject()->getProg());
+        for (UserProc *proc : procs) {
+            PassManager::get()->executePass(PassID::StatementInit, proc);
+            PassManager::get()->executePass(PassID::BBSimplify, proc);
+            PassManager::get()->executePass(PassID::Dominators, proc);
+            PassManager::get()->executePass(PassID::CallDefineUpdate, proc);
+            PassManager::get()->executePass(PassID::GlobalConstReplace, proc);
+            PassManager::get()->executePass(PassID::PhiPlacement, proc);
+        }
+        state.resumeTiming();
+
+        for (UserProc *proc : procs) {
+            PassManager::get()->executePass(PassID::BlockVarRename, proc);
+        }
+
+        state.addItemsProcessed(procs.size());
+    }
+}
+
+
+static void benchmarkStatementPropagation(BenchmarkState &state, const QString &relpath)
+{
+    while (state.keepRunning()) {
+        // Propagation modifies the procedures, so reload the binary every time
+        state.pauseTiming();
+        if (!loadSample(state, relpath, true)) {
+            return;
+        }
+
+        const std::vector<UserProc *> procs = getDecodedUserProcs(getBenchmarkProject()->getProg());
+        for (UserProc *proc : procs) {
+            runPassesUntilPropagation(proc);
+        }
+        state.resumeTiming();
+
+        for (UserProc *proc : procs) {
+            PassManager::get()->executePass(PassID::StatementPropagation, proc);
+        }
+
+        state.addItemsProcessed(procs.size());
+    }
+}
+
+
+BOOMERANG_BENCHMARK(StatementPropagationPass_pentium_encrypt, 5)
+{
+    benchmarkStatementPropagation(state, "pentium/encrypt");
+}
+
+
+BOOMERANG_BENCHMARK(StatementPropagationPass_sparc_banner, 5)
+{
+    benchmarkStatementPropagation(state, "sparc/banner");
+}
+
+
+BOOMERANG_BENCHMARK(BlockVarRenamePass_pentium_encrypt, 5)
+{
+    benchmarkBlockVarRename(state, "pentium/encrypt");
+}
+
+
+BOOMERANG_BENCHMARK(BlockVarRenamePass_sparc_banner, 5)
+{
+    benchmarkBlockVarRename(state, "sparc/banner");
+}
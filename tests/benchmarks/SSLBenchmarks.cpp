@@ -0,0 +1,59 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+#include "BenchmarkUtils.h"
+
+#include "boomerang/core/Settings.h"
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/RTLInstDict.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+
+#include <vector>
+
+
+BOOMERANG_BENCHMARK(RTLInstDict_instantiateRTL_SPARC, 10)
+{
+    RTLInstDict dict;
+    const QString sslPath = getBenchmarkProject()->getSettings()->getDataDirectory().absoluteFilePath(
+        "ssl/sparc.ssl");
+
+    if (!dict.readSSLFile(sslPath)) {
+        state.skip("Could not read sparc.ssl");
+        return;
+    }
+
+    // A mix of common integer, memory and flag setting instructions
+    const std::vector<std::pair<QString, std::vector<SharedExp>>> instructions = {
+        { "ADD", { Location::regOf(9), Const::get(4), Location::regOf(10) } },
+        { "SUBCC", { Location::regOf(9), Location::regOf(11), Location::regOf(0) } },
+        { "OR", { Location::regOf(16), Const::get(0xFF), Location::regOf(17) } },
+        { "SETHI", { Const::get(0x10000), Location::regOf(8) } },
+        { "LD", { Binary::get(opPlus, Location::regOf(30), Const::get(-20)), Location::regOf(8) } },
+        { "ST", { Location::regOf(8), Binary::get(opPlus, Location::regOf(30), Const::get(-24)) } },
+    };
+
+    const int rounds = 1000;
+
+    while (state.keepRunning()) {
+        Address pc = Address(0x10000);
+
+        for (int i = 0; i < rounds; i++) {
+            for (const auto &inst : instructions) {
+                std::unique_ptr<RTL> rtl = dict.instantiateRTL(inst.first, pc, inst.second);
+                Q_UNUSED(rtl);
+                pc += 4;
+            }
+        }
+
+        state.addItemsProcessed(rounds * instructions.size());
+    }
+}
@@ -0,0 +1,60 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+#include "BenchmarkUtils.h"
+
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ifc/ITypeRecovery.h"
+#include "boomerang/passes/PassManager.h"
+
+
+static void benchmarkDFATypeRecovery(BenchmarkState &state, const QString &relpath)
+{
+    while (state.keepRunning()) {
+        // Type recovery modifies the procedures, so reload the binary every time
+        state.pauseTiming();
+        if (!loadSample(state, relpath, true)) {
+            return;
+        }
+
+        ITypeRecovery *rec = getBenchmarkProject()->getTypeRecoveryEngine();
+        if (!rec) {
+            state.skip("No type recovery engine available");
+            return;
+        }
+
+        const std::vector<UserProc *> procs = getDecodedUserProcs(getBenchmarkProject()->getProg());
+        for (UserProc *proc : procs) {
+            runPassesUntilPropagation(proc);
+            PassManager::get()->executePass(PassID::StatementPropagation, proc);
+            PassManager::get()->executePass(PassID::ImplicitPlacement, proc);
+        }
+        state.resumeTiming();
+
+        for (UserProc *proc : procs) {
+            rec->recoverFunctionTypes(proc);
+        }
+
+        state.addItemsProcessed(procs.size());
+    }
+}
+
+
+BOOMERANG_BENCHMARK(DFATypeRecovery_pentium_encrypt, 5)
+{
+    benchmarkDFATypeRecovery(state, "pentium/encrypt");
+}
+
+
+BOOMERANG_BENCHMARK(DFATypeRecovery_sparc_banner, 5)
+{
+    benchmarkDFATypeRecovery(state, "sparc/banner");
+}
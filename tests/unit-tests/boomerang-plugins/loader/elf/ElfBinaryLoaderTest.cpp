@@ -60,6 +60,26 @@ void ElfBinaryLoaderTest::testElfLoadClang()
 }
 
 
+void ElfBinaryLoaderTest::testRelocations()
+{
+    QVERIFY(m_project.loadBinaryFile(HELLO_CLANG4));
+    BinaryFile *binary = m_project.getLoadedBinaryFile();
+    QVERIFY(binary != nullptr);
+
+    QVERIFY(binary->isRelocationAt(Address(0x08049FFC)));
+    QVERIFY(binary->isRelocationAt(Address(0x0804A00C)));
+    QVERIFY(binary->isRelocationAt(Address(0x0804A010)));
+    QVERIFY(!binary->isRelocationAt(Address(0x0804A008)));
+    QVERIFY(binary->getRelocationAt(Address(0x0804A008)) == nullptr);
+
+    const BinaryRelocation *reloc = binary->getRelocationAt(Address(0x0804A00C));
+    QVERIFY(reloc != nullptr);
+    QCOMPARE(reloc->addr, Address(0x0804A00C));
+    QCOMPARE(reloc->type, 7); // R_386_JMP_SLOT
+    QCOMPARE(reloc->symbolName, QString("printf"));
+}
+
+
 void ElfBinaryLoaderTest::testPentiumLoad()
 {
     // Load Pentium hello world
@@ -22,6 +22,9 @@ private slots:
     /// compiled with clang-4.0.0 (without debug info)
     void testElfLoadClang();
 
+    /// Test looking up relocations of the clang-4.0.0 "Hello World" program
+    void testRelocations();
+
     /// Test loading the Pentium (Solaris) hello world program
     void testPentiumLoad();
     void testPentiumLoad_data();
@@ -12,7 +12,30 @@
 
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Settings.h"
+#include "boomerang/core/Watcher.h"
 #include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/UserProc.h"
+
+
+class ProgressWatcher : public IWatcher
+{
+public:
+    void onInstructionDecoded(Address, int) override { numInstructionEvents++; }
+
+    void onDecodeProgress(int numInstructions, int) override
+    {
+        numDecodeProgressEvents++;
+        lastNumInstructions = numInstructions;
+    }
+
+    void onDecompileProgress(int) override { numDecompileProgressEvents++; }
+
+public:
+    int numInstructionEvents       = 0;
+    int numDecodeProgressEvents    = 0;
+    int numDecompileProgressEvents = 0;
+    int lastNumInstructions        = 0;
+};
 
 
 void ProjectTest::testLoadBinaryFile()
@@ -104,6 +127,45 @@ void ProjectTest::testDecompileBinaryFile()
 }
 
 
+void ProjectTest::testDecompileProc()
+{
+    Project project;
+    project.getSettings()->setDataDirectory(BOOMERANG_TEST_BASE "share/boomerang/");
+    project.getSettings()->setPluginDirectory(BOOMERANG_TEST_BASE "lib/boomerang/plugins/");
+    project.loadPlugins();
+
+    QVERIFY(!project.decompileProc(nullptr));
+
+    QVERIFY(project.loadBinaryFile(getFullSamplePath("pentium/twoproc")));
+    QVERIFY(project.decodeBinaryFile());
+
+    UserProc *main = dynamic_cast<UserProc *>(project.getProg()->getFunctionByName("main"));
+    QVERIFY(main != nullptr);
+    QVERIFY(!main->getCallees().empty());
+
+    // only main is decompiled, the callee is summarized
+    QVERIFY(project.decompileProc(main));
+    QVERIFY(main->isDecompiled());
+
+    UserProc *callee = nullptr;
+    for (Function *func : main->getCallees()) {
+        if (!func->isLib()) {
+            callee = static_cast<UserProc *>(func);
+        }
+    }
+
+    QVERIFY(callee != nullptr);
+    QVERIFY(!callee->isDecompiled());
+
+    // refine the callee later
+    while (project.refineCallees()) {
+    }
+
+    QVERIFY(callee->isDecompiled());
+    QVERIFY(!project.refineCallees());
+}
+
+
 void ProjectTest::testGenerateCode()
 {
     Project project;
@@ -122,4 +184,52 @@ void ProjectTest::testGenerateCode()
 }
 
 
+void ProjectTest::testWatcherGranularity()
+{
+    Project project;
+    project.getSettings()->setDataDirectory(BOOMERANG_TEST_BASE "share/boomerang/");
+    project.getSettings()->setPluginDirectory(BOOMERANG_TEST_BASE "lib/boomerang/plugins/");
+    project.loadPlugins();
+
+    ProgressWatcher summaryWatcher;
+    ProgressWatcher instructionWatcher;
+    project.addWatcher(&summaryWatcher);
+    project.addWatcher(&instructionWatcher, WatchGranularity::Instruction);
+
+    QVERIFY(project.loadBinaryFile(getFullSamplePath("elf/hello-clang4-dynamic")));
+    QVERIFY(project.decodeBinaryFile());
+
+    QCOMPARE(summaryWatcher.numInstructionEvents, 0);
+    QVERIFY(summaryWatcher.numDecodeProgressEvents > 0);
+    QVERIFY(instructionWatcher.numInstructionEvents > 0);
+    QCOMPARE(summaryWatcher.lastNumInstructions, instructionWatcher.numInstructionEvents);
+
+    QVERIFY(project.decompileBinaryFile());
+    QVERIFY(summaryWatcher.numDecompileProgressEvents > 0);
+}
+
+
+void ProjectTest::testRemoveWatcher()
+{
+    Project project;
+    project.getSettings()->setDataDirectory(BOOMERANG_TEST_BASE "share/boomerang/");
+    project.getSettings()->setPluginDirectory(BOOMERANG_TEST_BASE "lib/boomerang/plugins/");
+    project.loadPlugins();
+
+    ProgressWatcher keptWatcher;
+    ProgressWatcher removedWatcher;
+    project.addWatcher(&keptWatcher, WatchGranularity::Instruction);
+    project.addWatcher(&removedWatcher, WatchGranularity::Instruction);
+    project.removeWatcher(&removedWatcher);
+
+    QVERIFY(project.loadBinaryFile(getFullSamplePath("elf/hello-clang4-dynamic")));
+    QVERIFY(project.decodeBinaryFile());
+
+    QVERIFY(keptWatcher.numInstructionEvents > 0);
+    QVERIFY(keptWatcher.numDecodeProgressEvents > 0);
+    QCOMPARE(removedWatcher.numInstructionEvents, 0);
+    QCOMPARE(removedWatcher.numDecodeProgressEvents, 0);
+}
+
+
 QTEST_GUILESS_MAIN(ProjectTest)
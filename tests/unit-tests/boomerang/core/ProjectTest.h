@@ -33,5 +33,10 @@ private slots:
 
     void testDecodeBinaryFile();
     void testDecompileBinaryFile();
+    void testDecompileProc();
     void testGenerateCode();
+
+    /// Test that watchers only receive the progress events they subscribed to.
+    void testWatcherGranularity();
+    void testRemoveWatcher();
 };
@@ -113,6 +113,37 @@ void DataFlowTest::testCalculateDominators()
 }
 
 
+void DataFlowTest::testCompact()
+{
+    UserProc proc(Address(0x1000), "test", nullptr);
+    ProcCFG *cfg = proc.getCFG();
+    DataFlow *df = proc.getDataFlow();
+
+    BasicBlock *a = cfg->createBB(BBType::Twoway, createRTLs(Address(0x1000), 1));
+    BasicBlock *b = cfg->createBB(BBType::Oneway, createRTLs(Address(0x1001), 1));
+    BasicBlock *c = cfg->createBB(BBType::Oneway, createRTLs(Address(0x1002), 1));
+    BasicBlock *d = cfg->createBB(BBType::Ret,    createRTLs(Address(0x1003), 1));
+
+    cfg->addEdge(a, b); cfg->addEdge(a, c);
+    cfg->addEdge(b, d);
+    cfg->addEdge(c, d);
+
+    proc.setEntryBB();
+    df->calculateDominators();
+    df->compact();
+
+    QCOMPARE(df->getDominator(b), a);
+    QCOMPARE(df->getDominator(c), a);
+    QCOMPARE(df->getDominator(d), a);
+
+    // recalculating after compacting must give the same result
+    df->calculateDominators();
+    QCOMPARE(df->getDominator(d), a);
+    QCOMPARE(df->getDominanceFrontier(b), std::set<const BasicBlock *>({ d }));
+    QCOMPARE(df->getDominanceFrontier(c), std::set<const BasicBlock *>({ d }));
+}
+
+
 void DataFlowTest::testPlacePhi()
 {
     QVERIFY(m_project.loadBinaryFile(FRONTIER_PENTIUM));
@@ -24,6 +24,9 @@ private slots:
     /// Test calculating (semi-)dominators and the Dominance Frontier
     void testCalculateDominators();
 
+    /// Test that compacting keeps the dominator tree
+    void testCompact();
+
     /// Test the placing of phi functions
     void testPlacePhi();
 
@@ -0,0 +1,141 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DefCollectorTest.h"
+
+
+#include "boomerang/db/DefCollector.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/exp/Ternary.h"
+#include "boomerang/ssl/statements/Assign.h"
+
+#include <iterator>
+
+
+static int numDefs(const DefCollector &col)
+{
+    return static_cast<int>(std::distance(col.begin(), col.end()));
+}
+
+
+void DefCollectorTest::testInsert()
+{
+    DefCollector col;
+    col.insert(new Assign(Location::regOf(REG_PENT_EAX), Const::get(5)));
+    QCOMPARE(numDefs(col), 1);
+
+    // already defined, so this one is deleted
+    col.insert(new Assign(Location::regOf(REG_PENT_EAX), Const::get(6)));
+    QCOMPARE(numDefs(col), 1);
+    QCOMPARE(col.findDefFor(Location::regOf(REG_PENT_EAX))->toString(), QString("5"));
+}
+
+
+void DefCollectorTest::testUpdateDefs()
+{
+    Assign def1(Location::regOf(REG_PENT_EAX), Const::get(5));
+    Assign def2(Location::regOf(REG_PENT_ECX), Const::get(6));
+    Assign def3(Location::regOf(REG_PENT_EDX), Const::get(7));
+
+    std::map<SharedExp, std::deque<Statement *>, lessExpStar> stacks;
+    stacks[Location::regOf(REG_PENT_EAX)].push_back(&def1);
+    stacks[Location::regOf(REG_PENT_ECX)].push_back(&def2);
+    stacks[Location::regOf(REG_PENT_ECX)].push_back(&def3);
+    stacks[Location::regOf(REG_PENT_EDX)]; // does not reach
+
+    DefCollector col;
+    QVERIFY(!col.isInitialised());
+
+    col.updateDefs(stacks, nullptr);
+    QVERIFY(col.isInitialised());
+    QCOMPARE(numDefs(col), 2);
+
+    SharedExp eaxDef = col.findDefFor(Location::regOf(REG_PENT_EAX));
+    QVERIFY(eaxDef != nullptr && eaxDef->isSubscript());
+    QVERIFY(eaxDef->access<RefExp>()->getDef() == &def1);
+
+    // the last definition on the stack reaches
+    SharedExp ecxDef = col.findDefFor(Location::regOf(REG_PENT_ECX));
+    QVERIFY(ecxDef != nullptr && ecxDef->isSubscript());
+    QVERIFY(ecxDef->access<RefExp>()->getDef() == &def3);
+
+    QVERIFY(col.findDefFor(Location::regOf(REG_PENT_EDX)) == nullptr);
+
+    // existing definitions are kept
+    stacks[Location::regOf(REG_PENT_EAX)].push_back(&def3);
+    col.updateDefs(stacks, nullptr);
+    QCOMPARE(numDefs(col), 2);
+    QVERIFY(col.findDefFor(Location::regOf(REG_PENT_EAX))->access<RefExp>()->getDef() == &def1);
+}
+
+
+void DefCollectorTest::testUpdateDefsBitExtract()
+{
+    // eax@[0:7] also defines eax
+    const SharedExp lowByte = Ternary::get(opAt, Location::regOf(REG_PENT_EAX), Const::get(0),
+                                           Const::get(7));
+
+    Assign def1(Location::regOf(REG_PENT_EAX), Const::get(5));
+    Assign def2(Location::regOf(REG_PENT_ECX), Const::get(6));
+
+    std::map<SharedExp, std::deque<Statement *>, lessExpStar> stacks;
+    stacks[Location::regOf(REG_PENT_EAX)].push_back(&def1);
+    stacks[Location::regOf(REG_PENT_ECX)].push_back(&def2);
+
+    DefCollector col;
+    col.insert(new Assign(lowByte->clone(), Const::get(18)));
+    col.updateDefs(stacks, nullptr);
+
+    QCOMPARE(numDefs(col), 2);
+    QVERIFY(col.findDefFor(Location::regOf(REG_PENT_EAX)) == nullptr);
+    QCOMPARE(col.findDefFor(lowByte)->toString(), QString("18"));
+    QVERIFY(col.findDefFor(Location::regOf(REG_PENT_ECX)) != nullptr);
+
+    // eax@[0:7] reaching as well as eax:
+    // eax is visited first, so both get a definition.
+    stacks[lowByte->clone()].push_back(&def2);
+
+    DefCollector col2;
+    col2.updateDefs(stacks, nullptr);
+
+    QCOMPARE(numDefs(col2), 3);
+    QVERIFY(col2.findDefFor(Location::regOf(REG_PENT_EAX)) != nullptr);
+    QVERIFY(col2.findDefFor(lowByte) != nullptr);
+}
+
+
+void DefCollectorTest::testFindDefFor()
+{
+    DefCollector col;
+    QVERIFY(col.findDefFor(Location::regOf(REG_PENT_EAX)) == nullptr);
+
+    col.insert(new Assign(Location::regOf(REG_PENT_EAX), Const::get(5)));
+    col.insert(new Assign(Location::regOf(REG_PENT_ECX), Const::get(6)));
+    col.insert(new Assign(Location::memOf(Location::regOf(REG_PENT_ESP)), Const::get(7)));
+
+    QCOMPARE(col.findDefFor(Location::regOf(REG_PENT_EAX))->toString(), QString("5"));
+    QCOMPARE(col.findDefFor(Location::regOf(REG_PENT_ECX))->toString(), QString("6"));
+    QCOMPARE(col.findDefFor(Location::memOf(Location::regOf(REG_PENT_ESP)))->toString(),
+             QString("7"));
+
+    QVERIFY(col.findDefFor(Location::regOf(REG_PENT_EDX)) == nullptr);
+    QVERIFY(col.findDefFor(Location::memOf(Location::regOf(REG_PENT_EBP))) == nullptr);
+
+    // LHS modified after insertion, so the definitions are no longer sorted
+    bool changed = false;
+    col.searchReplaceAll(*Location::regOf(REG_PENT_EAX), Location::regOf(REG_PENT_EDI), changed);
+    QVERIFY(changed);
+    QCOMPARE(col.findDefFor(Location::regOf(REG_PENT_EDI))->toString(), QString("5"));
+    QVERIFY(col.findDefFor(Location::regOf(REG_PENT_EAX)) == nullptr);
+}
+
+
+QTEST_GUILESS_MAIN(DefCollectorTest)
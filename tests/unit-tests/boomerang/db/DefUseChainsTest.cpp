@@ -0,0 +1,137 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DefUseChainsTest.h"
+
+
+#include "boomerang/db/DefUseChains.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/util/StatementList.h"
+
+
+void DefUseChainsTest::testBuild()
+{
+    // 1 eax := 5
+    // 2 ecx := eax{1}
+    // 3 edx := eax{1} + ecx{2}
+    Assign a1(Location::regOf(REG_PENT_EAX), Const::get(5));
+    Assign a2(Location::regOf(REG_PENT_ECX), RefExp::get(Location::regOf(REG_PENT_EAX), &a1));
+    Assign a3(Location::regOf(REG_PENT_EDX),
+              Binary::get(opPlus, RefExp::get(Location::regOf(REG_PENT_EAX), &a1),
+                          RefExp::get(Location::regOf(REG_PENT_ECX), &a2)));
+
+    StatementList stmts;
+    stmts.append(&a1);
+    stmts.append(&a2);
+    stmts.append(&a3);
+
+    DefUseChains defUses;
+    defUses.build(stmts);
+
+    QCOMPARE(defUses.getNumUses(&a1), 2);
+    QCOMPARE(defUses.getNumUses(&a2), 1);
+    QCOMPARE(defUses.getNumUses(&a3), 0);
+
+    QVERIFY(defUses.getUses(&a1).contains(&a2));
+    QVERIFY(defUses.getUses(&a1).contains(&a3));
+    QVERIFY(defUses.getUses(&a2).contains(&a3));
+    QVERIFY(defUses.getUses(&a3).empty());
+
+    defUses.clear();
+    QVERIFY(!defUses.isUsed(&a1));
+}
+
+
+void DefUseChainsTest::testRemoveStatement()
+{
+    // 1 eax := 5
+    // 2 ecx := eax{1}
+    // 3 edx := eax{1} + ecx{2}
+    Assign a1(Location::regOf(REG_PENT_EAX), Const::get(5));
+    Assign a2(Location::regOf(REG_PENT_ECX), RefExp::get(Location::regOf(REG_PENT_EAX), &a1));
+    Assign a3(Location::regOf(REG_PENT_EDX),
+              Binary::get(opPlus, RefExp::get(Location::regOf(REG_PENT_EAX), &a1),
+                          RefExp::get(Location::regOf(REG_PENT_ECX), &a2)));
+
+    StatementList stmts;
+    stmts.append(&a1);
+    stmts.append(&a2);
+    stmts.append(&a3);
+
+    DefUseChains defUses;
+    defUses.build(stmts);
+
+    // a1 is still used by a2
+    StatementSet unused = defUses.removeStatement(&a3);
+    QCOMPARE(unused.size(), 1);
+    QVERIFY(unused.contains(&a2));
+    QCOMPARE(defUses.getNumUses(&a1), 1);
+    QVERIFY(!defUses.isUsed(&a2));
+
+    unused = defUses.removeStatement(&a2);
+    QCOMPARE(unused.size(), 1);
+    QVERIFY(unused.contains(&a1));
+    QVERIFY(!defUses.isUsed(&a1));
+
+    QVERIFY(defUses.removeStatement(&a1).empty());
+    QVERIFY(defUses.getDestCounts().empty());
+}
+
+
+void DefUseChainsTest::testUpdateStatement()
+{
+    // 1 eax := 5
+    // 2 ecx := eax{1}
+    // 3 edx := eax{1} + ecx{2}
+    Assign a1(Location::regOf(REG_PENT_EAX), Const::get(5));
+    Assign a2(Location::regOf(REG_PENT_ECX), RefExp::get(Location::regOf(REG_PENT_EAX), &a1));
+    Assign a3(Location::regOf(REG_PENT_EDX),
+              Binary::get(opPlus, RefExp::get(Location::regOf(REG_PENT_EAX), &a1),
+                          RefExp::get(Location::regOf(REG_PENT_ECX), &a2)));
+
+    StatementList stmts;
+    stmts.append(&a1);
+    stmts.append(&a2);
+    stmts.append(&a3);
+
+    DefUseChains defUses;
+    defUses.build(stmts);
+
+    const SharedExp eax1 = RefExp::get(Location::regOf(REG_PENT_EAX), &a1);
+    const SharedExp ecx2 = RefExp::get(Location::regOf(REG_PENT_ECX), &a2);
+
+    QCOMPARE(defUses.getDestCounts().size(), static_cast<size_t>(2));
+    QCOMPARE(defUses.getDestCounts().at(eax1), 2);
+    QCOMPARE(defUses.getDestCounts().at(ecx2), 1);
+
+    // propagate ecx{2} into 3: edx := eax{1} + eax{1}
+    a3.setRight(Binary::get(opPlus, RefExp::get(Location::regOf(REG_PENT_EAX), &a1),
+                            RefExp::get(Location::regOf(REG_PENT_EAX), &a1)));
+    defUses.updateStatement(&a3);
+
+    QCOMPARE(defUses.getNumUses(&a1), 2);
+    QVERIFY(defUses.getUses(&a1).contains(&a3));
+    QVERIFY(!defUses.isUsed(&a2));
+
+    QCOMPARE(defUses.getDestCounts().size(), static_cast<size_t>(1));
+    QCOMPARE(defUses.getDestCounts().at(eax1), 3);
+
+    // 2 ecx := 5
+    a2.setRight(Const::get(5));
+    defUses.updateStatement(&a2);
+    QCOMPARE(defUses.getNumUses(&a1), 1);
+    QCOMPARE(defUses.getDestCounts().at(eax1), 2);
+}
+
+
+QTEST_GUILESS_MAIN(DefUseChainsTest)
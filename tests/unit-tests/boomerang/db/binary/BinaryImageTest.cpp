@@ -181,6 +181,32 @@ void BinaryImageTest::testRead()
 }
 
 
+void BinaryImageTest::testReadArray()
+{
+    char sectionData[12] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                             0x08, 0x09, 0x0A, 0x0B };
+    DWord values[4]      = { 0 };
+
+    BinaryImage img(QByteArray{});
+    QCOMPARE(img.readNative4Array(Address(0x1000), values, 3), 0);
+
+    BinarySection *sect1 = img.createSection("sect1", Address(0x1000), Address(0x100C));
+    sect1->setHostAddr(HostAddress(sectionData));
+    sect1->addDefinedArea(Address(0x1000), Address(0x1000) + sizeof(sectionData));
+
+    QCOMPARE(img.readNative4Array(Address(0x1000), values, 3), 3);
+    QCOMPARE(values[0], static_cast<DWord>(0x33221100));
+    QCOMPARE(values[1], static_cast<DWord>(0x77665544));
+    QCOMPARE(values[2], static_cast<DWord>(0x0B0A0908));
+
+    // read stops at the section boundary
+    QCOMPARE(img.readNative4Array(Address(0x1004), values, 4), 2);
+    QCOMPARE(values[0], static_cast<DWord>(0x77665544));
+    QCOMPARE(values[1], static_cast<DWord>(0x0B0A0908));
+    QCOMPARE(img.readNative4Array(Address(0x1009), values, 1), 0);
+}
+
+
 void BinaryImageTest::testWrite()
 {
     char sectionData[8] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77 };
@@ -28,6 +28,7 @@ private slots:
     void testUpdateTextLimits();
 
     void testRead();
+    void testReadArray();
     void testWrite();
 
     void testIsReadOnly();
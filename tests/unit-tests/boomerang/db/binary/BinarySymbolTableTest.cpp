@@ -46,6 +46,30 @@ void BinarySymbolTableTest::testClear()
 }
 
 
+void BinarySymbolTableTest::testReserve()
+{
+    BinarySymbolTable tbl;
+    tbl.reserve(1000);
+    QVERIFY(tbl.empty());
+
+    // symbols must not move when more symbols are added
+    BinarySymbol *first = tbl.createSymbol(Address(0x1000), "sym0");
+
+    for (int i = 1; i < 2000; i++) {
+        tbl.createSymbol(Address(0x1000 + 4 * i), QString("sym%1").arg(i));
+    }
+
+    QCOMPARE(tbl.size(), 2000);
+    QVERIFY(tbl.findSymbolByAddress(Address(0x1000)) == first);
+    QVERIFY(tbl.findSymbolByName("sym0") == first);
+    QCOMPARE(first->getName(), QString("sym0"));
+
+    const BinarySymbol *last = tbl.findSymbolByName("sym1999");
+    QVERIFY(last != nullptr);
+    QCOMPARE(last->getLocation(), Address(0x1000 + 4 * 1999));
+}
+
+
 void BinarySymbolTableTest::testCreateSymbol()
 {
     BinarySymbolTable tbl;
@@ -21,6 +21,7 @@ private slots:
     void testSize();
     void testEmpty();
     void testClear();
+    void testReserve();
 
     void testCreateSymbol();
     void testFindSymbolByAddress();
@@ -0,0 +1,154 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "LibraryPatternMatcherTest.h"
+
+
+#include "boomerang/db/binary/BinaryImage.h"
+#include "boomerang/db/binary/BinarySection.h"
+#include "boomerang/db/binary/BinarySymbol.h"
+#include "boomerang/db/binary/BinarySymbolTable.h"
+#include "boomerang/db/binary/LibraryPatternMatcher.h"
+
+#include <cstring>
+
+
+// clang-format off
+static const Byte funcCode[40] = {
+    0x55, 0x89, 0xE5, 0x83, 0xEC, 0x08, 0xE8, 0x11, 0x22, 0x33, 0x44, 0x8B, 0x45, 0x08, 0x85, 0xC0,
+    0x74, 0x0A, 0x8B, 0x55, 0x0C, 0x01, 0xD0, 0x89, 0x45, 0xFC, 0x8B, 0x45, 0xFC, 0x83, 0xC0, 0x01,
+    0x89, 0x45, 0xFC, 0x8B, 0x45, 0xFC, 0xC9, 0xC3
+};
+// clang-format on
+
+
+/// Pattern for funcCode, with the call target (bytes 7 to 10) masked out
+static QString makeFuncPattern(const QString &name)
+{
+    QString bytes;
+    for (int i = 0; i < LibraryPatternMatcher::PATTERN_LENGTH; i++) {
+        bytes += (i >= 7 && i <= 10) ? QString("..")
+                                     : QString("%1").arg(funcCode[i], 2, 16, QChar('0')).toUpper();
+    }
+
+    const SWord crc = LibraryPatternMatcher::crc16(funcCode + 32, 8);
+    return QString("%1 08 %2 0028 :0000 %3").arg(bytes).arg(crc, 4, 16, QChar('0')).arg(name);
+}
+
+
+void LibraryPatternMatcherTest::testAddPattern()
+{
+    LibraryPatternMatcher matcher;
+    QCOMPARE(matcher.getNumPatterns(), 0);
+
+    QVERIFY(matcher.addPattern(makeFuncPattern("foo")));
+    QCOMPARE(matcher.getNumPatterns(), 1);
+    QCOMPARE(matcher.getPatternName(0), QString("foo"));
+
+    const QString bytes = makeFuncPattern("foo").section(' ', 0, 0);
+    QVERIFY(!matcher.addPattern(""));
+    QVERIFY(!matcher.addPattern(bytes + " 08 1234 0028"));                      // no name
+    QVERIFY(!matcher.addPattern(bytes.left(63) + " 08 1234 0028 :0000 baz"));   // too short
+    QVERIFY(!matcher.addPattern(bytes.left(62) + "XX 08 1234 0028 :0000 baz")); // not hex
+    QVERIFY(!matcher.addPattern(bytes + " 08 1234 XYZ :0000 baz"));             // invalid length
+    QVERIFY(!matcher.addPattern(bytes + " 08 1234 0027 :0000 baz")); // shorter than the CRC
+
+    // functions that are too short to have a CRC are not recognized reliably
+    QVERIFY(!matcher.addPattern(bytes + " 00 0000 0020 :0000 baz"));
+
+    // at least half of the leading bytes must be fixed (bytes 7 to 10 vary)
+    QVERIFY(!matcher.addPattern(bytes.left(38) + QString(26, '.') + " 08 1234 0028 :0000 baz"));
+    QVERIFY(matcher.addPattern(bytes.left(40) + QString(24, '.') + " 08 1234 0028 :0000 baz"));
+    QCOMPARE(matcher.getNumPatterns(), 2);
+}
+
+
+void LibraryPatternMatcherTest::testCRC16()
+{
+    const char *data = "123456789";
+
+    QCOMPARE(LibraryPatternMatcher::crc16(nullptr, 0), static_cast<SWord>(0));
+    QCOMPARE(LibraryPatternMatcher::crc16(reinterpret_cast<const Byte *>(data), 9),
+             static_cast<SWord>(0x6E90));
+}
+
+
+void LibraryPatternMatcherTest::testMatch()
+{
+    LibraryPatternMatcher matcher;
+    QVERIFY(matcher.addPattern(makeFuncPattern("foo")));
+
+    Byte code[sizeof(funcCode)];
+    memcpy(code, funcCode, sizeof(code));
+
+    QCOMPARE(matcher.match(code, sizeof(code)), 0);
+
+    // wildcard bytes may differ
+    code[8] = 0xFF;
+    QCOMPARE(matcher.match(code, sizeof(code)), 0);
+
+    // function extends beyond the available data
+    QCOMPARE(matcher.match(code, sizeof(code) - 1), -1);
+
+    // bytes after the leading pattern are checked by the CRC
+    code[35] = 0x00;
+    QCOMPARE(matcher.match(code, sizeof(code)), -1);
+
+    code[35] = funcCode[35];
+    code[0]  = 0x90;
+    QCOMPARE(matcher.match(code, sizeof(code)), -1);
+
+    // not enough data for the leading bytes
+    QCOMPARE(matcher.match(funcCode, 4), -1);
+    QCOMPARE(matcher.match(funcCode, 0), -1);
+}
+
+
+void LibraryPatternMatcherTest::testMarkLibraryFunctions()
+{
+    Byte sectionData[16 + sizeof(funcCode) + 8];
+    memset(sectionData, 0x90, sizeof(sectionData));
+    memcpy(sectionData + 16, funcCode, sizeof(funcCode));
+
+    BinaryImage img(QByteArray{});
+    BinarySection *text = img.createSection(".text", Address(0x1000),
+                                            Address(0x1000) + sizeof(sectionData));
+    QVERIFY(text != nullptr);
+    text->setHostAddr(HostAddress(sectionData));
+
+    LibraryPatternMatcher matcher;
+    QVERIFY(matcher.addPattern(makeFuncPattern("foo")));
+
+    BinarySymbolTable symbols;
+
+    // only code sections are scanned
+    text->setCode(false);
+    QCOMPARE(matcher.markLibraryFunctions(&img, &symbols), 0);
+    QVERIFY(symbols.empty());
+
+    text->setCode(true);
+    QCOMPARE(matcher.markLibraryFunctions(&img, &symbols), 1);
+
+    const BinarySymbol *sym = symbols.findSymbolByAddress(Address(0x1010));
+    QVERIFY(sym != nullptr);
+    QCOMPARE(sym->getName(), QString("foo"));
+    QVERIFY(sym->isFunction());
+    QVERIFY(sym->isStaticFunction());
+
+    // existing symbols are neither renamed nor marked as library functions
+    BinarySymbolTable symbols2;
+    symbols2.createSymbol(Address(0x1010), "my_foo");
+    QCOMPARE(matcher.markLibraryFunctions(&img, &symbols2), 0);
+    QVERIFY(symbols2.findSymbolByName("foo") == nullptr);
+    QVERIFY(!symbols2.findSymbolByName("my_foo")->isStaticFunction());
+    QCOMPARE(symbols2.size(), 1);
+}
+
+
+QTEST_GUILESS_MAIN(LibraryPatternMatcherTest)
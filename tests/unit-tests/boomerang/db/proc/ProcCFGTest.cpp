@@ -219,6 +219,7 @@ void ProcCFGTest::testRemoveBB()
     bb = cfg->createBB(BBType::Oneway, createRTLs(Address(0x1000), 1));
     cfg->removeBB(bb);
     QCOMPARE(cfg->getNumBBs(), 0);
+    QVERIFY(!cfg->hasBB(bb));
 }
 
 
@@ -305,4 +306,136 @@ void ProcCFGTest::testIsWellFormed()
 }
 
 
+void ProcCFGTest::testGetStatements()
+{
+    UserProc proc(Address(0x1000), "test", nullptr);
+    ProcCFG *cfg = proc.getCFG();
+
+    QVERIFY(cfg->getStatements().empty());
+
+    BasicBlock *bb1 = cfg->createBB(BBType::Fall, createRTLs(Address(0x1000), 2));
+    QCOMPARE(cfg->getStatements().size(), static_cast<size_t>(2));
+    QCOMPARE(cfg->getAssigns().size(), static_cast<size_t>(2));
+    QVERIFY(cfg->getPhis().empty());
+    QVERIFY(cfg->getCalls().empty());
+    QVERIFY(cfg->getStatements().front()->getProc() == &proc);
+
+    // adding statements to an existing RTL must update the index
+    Assign *asgn = new Assign(VoidType::get(), Terminal::get(opNil), Terminal::get(opNil));
+    bb1->getRTLs()->back()->append(asgn);
+    QCOMPARE(cfg->getStatements().size(), static_cast<size_t>(3));
+    QVERIFY(cfg->getStatements().back() == asgn);
+
+    // adding a BB must update the index
+    BasicBlock *bb2 = cfg->createBB(BBType::Ret, createRTLs(Address(0x1002), 1));
+    QCOMPARE(cfg->getStatements().size(), static_cast<size_t>(4));
+
+    // removing a BB must update the index
+    cfg->removeBB(bb2);
+    QCOMPARE(cfg->getStatements().size(), static_cast<size_t>(3));
+
+    StatementList stmts;
+    proc.getStatements(stmts);
+    QCOMPARE(stmts.size(), static_cast<size_t>(3));
+}
+
+
+void ProcCFGTest::testModificationCount()
+{
+    UserProc proc1(Address(0x1000), "test1", nullptr);
+    UserProc proc2(Address(0x2000), "test2", nullptr);
+    ProcCFG *cfg1 = proc1.getCFG();
+    ProcCFG *cfg2 = proc2.getCFG();
+
+    BasicBlock *bb1 = cfg1->createBB(BBType::Fall, createRTLs(Address(0x1000), 2));
+    cfg2->createBB(BBType::Ret, createRTLs(Address(0x2000), 1));
+    QCOMPARE(cfg1->getStatements().size(), static_cast<size_t>(2));
+    QCOMPARE(cfg2->getStatements().size(), static_cast<size_t>(1));
+
+    const uint64 count1 = cfg1->getModificationCount();
+    const uint64 count2 = cfg2->getModificationCount();
+
+    // reading statements or RTLs must not invalidate the index
+    cfg1->getStatements();
+    bb1->getRTLs();
+    QCOMPARE(cfg1->getModificationCount(), count1);
+
+    // modifying one CFG must not invalidate the index of other CFGs
+    bb1->getRTLs()->back()->append(
+        new Assign(VoidType::get(), Terminal::get(opNil), Terminal::get(opNil)));
+    QVERIFY(cfg1->getModificationCount() != count1);
+    QCOMPARE(cfg2->getModificationCount(), count2);
+    QCOMPARE(cfg1->getStatements().size(), static_cast<size_t>(3));
+
+    // RTLs outside of a BB do not belong to any CFG
+    const uint64 count1Modified = cfg1->getModificationCount();
+    RTL rtl(Address(0x3000));
+    rtl.append(new Assign(VoidType::get(), Terminal::get(opNil), Terminal::get(opNil)));
+    QCOMPARE(cfg1->getModificationCount(), count1Modified);
+    QCOMPARE(cfg2->getModificationCount(), count2);
+
+    // statements replaced in place must be reported explicitly
+    RTL *lastRTL = bb1->getLastRTL();
+    delete lastRTL->back();
+    lastRTL->back() = new Assign(VoidType::get(), Terminal::get(opNil), Terminal::get(opNil));
+    lastRTL->markModified();
+    QVERIFY(cfg1->getModificationCount() != count1Modified);
+}
+
+
+void ProcCFGTest::testSplitBB()
+{
+    UserProc proc(Address(0x1000), "test", nullptr);
+    ProcCFG *cfg = proc.getCFG();
+
+    BasicBlock *bb = cfg->createBB(BBType::Oneway, createRTLs(Address(0x1000), 8));
+
+    // split in the lower half
+    BasicBlock *high1 = cfg->splitBB(bb, Address(0x1001));
+    QVERIFY(high1 != bb);
+    QVERIFY(cfg->hasBB(high1));
+    QCOMPARE(cfg->getNumBBs(), 2);
+    QCOMPARE(bb->getHiAddr(), Address(0x1000));
+    QCOMPARE(high1->getLowAddr(), Address(0x1001));
+    QCOMPARE(high1->getHiAddr(), Address(0x1007));
+    QCOMPARE(high1->getRTLs()->size(), static_cast<size_t>(7));
+    QVERIFY(high1->isType(BBType::Oneway));
+    QVERIFY(bb->isType(BBType::Fall));
+
+    // split in the upper half
+    BasicBlock *high2 = cfg->splitBB(high1, Address(0x1006));
+    QCOMPARE(cfg->getNumBBs(), 3);
+    QCOMPARE(high1->getHiAddr(), Address(0x1005));
+    QCOMPARE(high2->getLowAddr(), Address(0x1006));
+    QCOMPARE(high2->getHiAddr(), Address(0x1007));
+
+    // invalid split address
+    QVERIFY(cfg->splitBB(high2, Address(0x2000)) == high2);
+    QCOMPARE(cfg->getNumBBs(), 3);
+}
+
+
+void ProcCFGTest::testSplitBBSameAddress()
+{
+    UserProc proc(Address(0x1000), "test", nullptr);
+    ProcCFG *cfg = proc.getCFG();
+
+    // two RTLs at 0x1006 in the upper half of the BB
+    std::unique_ptr<RTLList> rtls = createRTLs(Address(0x1000), 7);
+    rtls->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1006),
+        { new Assign(VoidType::get(), Terminal::get(opNil), Terminal::get(opNil)) })));
+    rtls->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1007),
+        { new Assign(VoidType::get(), Terminal::get(opNil), Terminal::get(opNil)) })));
+
+    BasicBlock *bb = cfg->createBB(BBType::Oneway, std::move(rtls));
+
+    BasicBlock *high = cfg->splitBB(bb, Address(0x1006));
+    QVERIFY(high != bb);
+    QCOMPARE(bb->getRTLs()->size(), static_cast<size_t>(6));
+    QCOMPARE(bb->getHiAddr(), Address(0x1005));
+    QCOMPARE(high->getRTLs()->size(), static_cast<size_t>(3));
+    QCOMPARE(high->getLowAddr(), Address(0x1006));
+}
+
+
 QTEST_GUILESS_MAIN(ProcCFGTest)
@@ -31,4 +31,8 @@ private slots:
     void testRemoveBB();
     void testAddEdge();
     void testIsWellFormed();
+    void testGetStatements();
+    void testModificationCount();
+    void testSplitBB();
+    void testSplitBBSameAddress(); /// tests splitting before the first of several RTLs with the same address
 };
@@ -82,6 +82,21 @@ void UserProcTest::testRemoveStatement()
     proc.getCFG()->createBB(BBType::Fall, std::move(bbRTLs));
     QVERIFY(proc.removeStatement(asgn));
 
+    // up to date def-use chains are updated
+    Assign *def = new Assign(VoidType::get(), Location::regOf(REG_PENT_EAX), Const::get(5));
+    Assign *use = new Assign(VoidType::get(), Location::regOf(REG_PENT_ECX),
+                             RefExp::get(Location::regOf(REG_PENT_EAX), def));
+
+    std::unique_ptr<RTLList> bb2RTLs(new RTLList);
+    bb2RTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x00000124), { def, use })));
+    proc.getCFG()->createBB(BBType::Fall, std::move(bb2RTLs));
+
+    QVERIFY(proc.getDefUseChains().getUses(def).contains(use));
+    QVERIFY(proc.removeStatement(use));
+    QVERIFY(!proc.getDefUseChains().isUsed(def));
+    QVERIFY(proc.getDefUseChains().getDestCounts().empty());
+    delete use;
+
     // todo: test that proven true cache is updated
 }
 
@@ -747,4 +762,28 @@ void UserProcTest::testAllPhisHaveDefs()
     QVERIFY(proc.allPhisHaveDefs());
 }
 
+
+void UserProcTest::testDegradedByBudget()
+{
+    QVERIFY(m_project.loadBinaryFile(HELLO_PENTIUM));
+    QVERIFY(m_project.decodeBinaryFile());
+    QVERIFY(m_project.decompileBinaryFile());
+
+    UserProc *mainProc = static_cast<UserProc *>(m_project.getProg()->getFunctionByName("main"));
+    QVERIFY(mainProc != nullptr && !mainProc->isLib());
+    QVERIFY(!mainProc->isDegraded());
+
+    m_project.getSettings()->procStmtBudget = 1;
+
+    QVERIFY(m_project.loadBinaryFile(HELLO_PENTIUM));
+    QVERIFY(m_project.decodeBinaryFile());
+    QVERIFY(m_project.decompileBinaryFile());
+
+    m_project.getSettings()->procStmtBudget = 0;
+
+    mainProc = static_cast<UserProc *>(m_project.getProg()->getFunctionByName("main"));
+    QVERIFY(mainProc != nullptr && !mainProc->isLib());
+    QVERIFY(mainProc->isDegraded());
+}
+
 QTEST_GUILESS_MAIN(UserProcTest)
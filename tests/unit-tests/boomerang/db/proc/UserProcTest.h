@@ -54,4 +54,5 @@ private slots:
     void testFindFirstSymbol();
     void testSearchAndReplace();
     void testAllPhisHaveDefs();
+    void testDegradedByBudget(); /// tests exceeding the statement budget marks procedures as degraded
 };
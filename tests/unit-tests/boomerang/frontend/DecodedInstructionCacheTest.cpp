@@ -0,0 +1,129 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DecodedInstructionCacheTest.h"
+
+
+#include "boomerang/frontend/DecodedInstructionCache.h"
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/statements/Assign.h"
+
+
+static void makeResult(Address pc, DecodeResult &result)
+{
+    result.reset();
+    result.rtl.reset(new RTL(pc, { new Assign(Location::regOf(REG_PENT_EAX), Const::get(42)) }));
+    result.numBytes = 5;
+}
+
+
+void DecodedInstructionCacheTest::testLookup()
+{
+    DecodedInstructionCache cache;
+    DecodeResult result;
+
+    QVERIFY(!cache.lookup(Address(0x1000), result));
+    QCOMPARE(cache.getNumMisses(), static_cast<std::size_t>(1));
+
+    makeResult(Address(0x1000), result);
+    cache.insert(Address(0x1000), result);
+    QCOMPARE(cache.size(), static_cast<std::size_t>(1));
+
+    DecodeResult cached;
+    QVERIFY(cache.lookup(Address(0x1000), cached));
+    QCOMPARE(cache.getNumHits(), static_cast<std::size_t>(1));
+    QVERIFY(cached.valid);
+    QCOMPARE(cached.numBytes, 5);
+    QVERIFY(cached.rtl != nullptr);
+    QVERIFY(cached.rtl != result.rtl);
+    QCOMPARE(cached.rtl->toString(), result.rtl->toString());
+
+    // modifying the returned RTL must not modify the cached one
+    cached.rtl->clear();
+    QVERIFY(cache.lookup(Address(0x1000), cached));
+    QCOMPARE(cached.rtl->toString(), result.rtl->toString());
+
+    cache.clear();
+    QCOMPARE(cache.size(), static_cast<std::size_t>(0));
+    QCOMPARE(cache.getNumHits(), static_cast<std::size_t>(0));
+    QVERIFY(!cache.lookup(Address(0x1000), cached));
+}
+
+
+void DecodedInstructionCacheTest::testReDecode()
+{
+    DecodedInstructionCache cache;
+    DecodeResult result;
+
+    makeResult(Address(0x1000), result);
+    result.reDecode = true;
+    cache.insert(Address(0x1000), result);
+    QVERIFY(!cache.lookup(Address(0x1000), result));
+
+    // the last part of the instruction is not cached either
+    makeResult(Address(0x1000), result);
+    cache.insert(Address(0x1000), result);
+    QVERIFY(!cache.lookup(Address(0x1000), result));
+
+    makeResult(Address(0x1000), result);
+    result.valid = false;
+    cache.insert(Address(0x2000), result);
+    QVERIFY(!cache.lookup(Address(0x2000), result));
+}
+
+
+void DecodedInstructionCacheTest::testCapacity()
+{
+    DecodedInstructionCache cache(2);
+    DecodeResult result;
+
+    for (Address pc : { Address(0x1000), Address(0x1005), Address(0x100A) }) {
+        makeResult(pc, result);
+        cache.insert(pc, result);
+    }
+
+    QCOMPARE(cache.size(), static_cast<std::size_t>(2));
+    QVERIFY(!cache.lookup(Address(0x1000), result));
+    QVERIFY(cache.lookup(Address(0x1005), result));
+    QVERIFY(cache.lookup(Address(0x100A), result));
+}
+
+
+void DecodedInstructionCacheTest::testCapacityReDecode()
+{
+    DecodedInstructionCache cache(2);
+    DecodeResult result;
+
+    for (Address pc : { Address(0x1000), Address(0x1005) }) {
+        makeResult(pc, result);
+        cache.insert(pc, result);
+    }
+
+    // 0x1000 turns out to need re-decoding
+    makeResult(Address(0x1000), result);
+    result.reDecode = true;
+    cache.insert(Address(0x1000), result);
+    QCOMPARE(cache.size(), static_cast<std::size_t>(1));
+
+    for (Address pc : { Address(0x100A), Address(0x100F) }) {
+        makeResult(pc, result);
+        cache.insert(pc, result);
+    }
+
+    QCOMPARE(cache.size(), static_cast<std::size_t>(2));
+    QVERIFY(!cache.lookup(Address(0x1000), result));
+    QVERIFY(!cache.lookup(Address(0x1005), result));
+    QVERIFY(cache.lookup(Address(0x100A), result));
+    QVERIFY(cache.lookup(Address(0x100F), result));
+}
+
+
+QTEST_GUILESS_MAIN(DecodedInstructionCacheTest)
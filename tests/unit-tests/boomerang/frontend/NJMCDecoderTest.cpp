@@ -0,0 +1,76 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "NJMCDecoderTest.h"
+
+
+#include "boomerang/core/Settings.h"
+#include "boomerang/frontend/NJMCDecoder.h"
+
+#include <cstring>
+
+
+/// Decoder without instruction matchers, to access the instruction handles
+class TestDecoder : public NJMCDecoder
+{
+public:
+    TestDecoder(Project *project)
+        : NJMCDecoder(project, "ssl/sparc.ssl")
+    {
+    }
+
+    bool decodeInstruction(Address, ptrdiff_t, DecodeResult &) override { return false; }
+
+    using NJMCDecoder::getInstructionHandle;
+    using NJMCDecoder::readSSLFile;
+};
+
+
+void NJMCDecoderTest::testGetInstructionHandle()
+{
+    TestDecoder decoder(&m_project);
+
+    const int addHandle = decoder.getDict()->getInstructionHandle("ADD");
+    const int subHandle = decoder.getDict()->getInstructionHandle("SUB");
+    QVERIFY(addHandle != -1);
+    QVERIFY(subHandle != -1);
+    QVERIFY(addHandle != subHandle);
+
+    // Same name at different addresses
+    char name1[] = "ADD";
+    char name2[] = "ADD";
+    QCOMPARE(decoder.getInstructionHandle(name1), addHandle);
+    QCOMPARE(decoder.getInstructionHandle(name2), addHandle);
+
+    // Different name at the same address
+    std::strcpy(name1, "SUB");
+    QCOMPARE(decoder.getInstructionHandle(name1), subHandle);
+
+    QCOMPARE(decoder.getInstructionHandle("FOOBAR"), -1);
+    QCOMPARE(decoder.getInstructionHandle("FOOBAR"), -1);
+}
+
+
+void NJMCDecoderTest::testReadSSLFile()
+{
+    TestDecoder decoder(&m_project);
+
+    QVERIFY(decoder.getInstructionHandle("LDUB") != -1);
+    QVERIFY(decoder.getInstructionHandle("ADD") != -1);
+
+    const QDir dataDir = m_project.getSettings()->getDataDirectory();
+    QVERIFY(decoder.readSSLFile(dataDir.absoluteFilePath("ssl/ppc.ssl")));
+
+    // LDUB is a SPARC instruction
+    QCOMPARE(decoder.getInstructionHandle("LDUB"), -1);
+    QCOMPARE(decoder.getInstructionHandle("ADD"), decoder.getDict()->getInstructionHandle("ADD"));
+}
+
+
+QTEST_GUILESS_MAIN(NJMCDecoderTest)
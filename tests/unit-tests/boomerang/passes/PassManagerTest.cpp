@@ -0,0 +1,102 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "PassManagerTest.h"
+
+
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/passes/PassManager.h"
+
+#include <limits>
+
+
+/// Pass that reports a change for the first \p numChanges executions
+class MockPass : public IPass
+{
+public:
+    MockPass(const QString &name, PassFacts inputs, PassFacts outputs, int numChanges)
+        : IPass(name, PassID::INVALID)
+        , m_inputs(inputs)
+        , m_outputs(outputs)
+        , m_numChanges(numChanges)
+    {
+    }
+
+public:
+    PassFacts getInputs() const override { return m_inputs; }
+    PassFacts getOutputs() const override { return m_outputs; }
+
+    bool execute(UserProc *) override { return m_numRuns++ < m_numChanges; }
+
+    int getNumRuns() const { return m_numRuns; }
+
+private:
+    PassFacts m_inputs;
+    PassFacts m_outputs;
+    int m_numChanges;
+    int m_numRuns = 0;
+};
+
+
+void PassManagerTest::testFixpointNoChange()
+{
+    Prog prog("test", &m_project);
+    UserProc proc(Address(0x1000), "test", prog.getRootModule());
+
+    MockPass pass("pass", PassFacts().set(), PassFacts().set(), 0);
+
+    QVERIFY(!PassManager::get()->executePassesToFixpoint({ &pass }, &proc, 10));
+    QCOMPARE(pass.getNumRuns(), 1);
+}
+
+
+void PassManagerTest::testFixpointFactPropagation()
+{
+    Prog prog("test", &m_project);
+    UserProc proc(Address(0x1000), "test", prog.getRootModule());
+
+    // a invalidates the input of b and vice versa; c does not depend on either of them
+    MockPass a("a", makePassFacts({ PassFact::CallDefines }),
+               makePassFacts({ PassFact::Statements }), 2);
+    MockPass b("b", makePassFacts({ PassFact::Statements }),
+               makePassFacts({ PassFact::CallDefines }), 2);
+    MockPass c("c", makePassFacts({ PassFact::Preservations }),
+               makePassFacts({ PassFact::Dominators }), 1);
+
+    QVERIFY(PassManager::get()->executePassesToFixpoint({ &a, &b, &c }, &proc, 100));
+
+    // Round 1: a (change), b (change), c (change)
+    // Round 2: a (change, since b changed call defines), b (change, since a changed statements)
+    // Round 3: a (no change), b is up to date
+    QCOMPARE(a.getNumRuns(), 3);
+    QCOMPARE(b.getNumRuns(), 2);
+    QCOMPARE(c.getNumRuns(), 1);
+}
+
+
+void PassManagerTest::testFixpointBudget()
+{
+    Prog prog("test", &m_project);
+    UserProc proc(Address(0x1000), "test", prog.getRootModule());
+
+    // a and b invalidate each other's inputs forever
+    MockPass a("a", makePassFacts({ PassFact::CallDefines }),
+               makePassFacts({ PassFact::Statements }), std::numeric_limits<int>::max());
+    MockPass b("b", makePassFacts({ PassFact::Statements }),
+               makePassFacts({ PassFact::CallDefines }), std::numeric_limits<int>::max());
+
+    QVERIFY(PassManager::get()->executePassesToFixpoint({ &a, &b }, &proc, 9));
+    QCOMPARE(a.getNumRuns() + b.getNumRuns(), 9);
+    QCOMPARE(a.getNumRuns(), 5);
+    QCOMPARE(b.getNumRuns(), 4);
+}
+
+
+QTEST_GUILESS_MAIN(PassManagerTest)
@@ -0,0 +1,24 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "TestUtils.h"
+
+
+class PassManagerTest : public BoomerangTestWithProject
+{
+    Q_OBJECT
+
+private slots:
+    void testFixpointNoChange();
+    void testFixpointFactPropagation(); /// tests that only passes with changed inputs are re-run
+    void testFixpointBudget(); /// tests stopping after the maximum number of pass executions
+};
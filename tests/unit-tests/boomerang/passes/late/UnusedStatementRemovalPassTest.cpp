@@ -0,0 +1,109 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "UnusedStatementRemovalPassTest.h"
+
+
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/passes/PassManager.h"
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/statements/ReturnStatement.h"
+
+#include <algorithm>
+
+
+static bool containsStatement(UserProc *proc, const Statement *stmt)
+{
+    StatementList stmts;
+    proc->getStatements(stmts);
+    return std::find(stmts.begin(), stmts.end(), stmt) != stmts.end();
+}
+
+
+void UnusedStatementRemovalPassTest::testRemoveUnused()
+{
+    Prog prog("test", &m_project);
+    UserProc proc(Address(0x1000), "test", prog.getRootModule());
+
+    // 1 ecx := 5
+    // 2 eax := ecx{1}
+    // 3 edx := 7
+    // 4 m[0x2000] := eax{2}
+    Assign *a1 = new Assign(Location::regOf(REG_PENT_ECX), Const::get(5));
+    Assign *a2 = new Assign(Location::regOf(REG_PENT_EAX),
+                            RefExp::get(Location::regOf(REG_PENT_ECX), a1));
+    Assign *a3 = new Assign(Location::regOf(REG_PENT_EDX), Const::get(7));
+    Assign *a4 = new Assign(Location::memOf(Const::get(0x2000)),
+                            RefExp::get(Location::regOf(REG_PENT_EAX), a2));
+    ReturnStatement *ret = new ReturnStatement();
+
+    std::unique_ptr<RTLList> bbRTLs(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { a1, a2, a3, a4 })));
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1010), { ret })));
+    proc.getCFG()->createBB(BBType::Ret, std::move(bbRTLs));
+    proc.setEntryBB();
+    proc.setRetStmt(ret, Address(0x1010));
+    PassManager::get()->executePass(PassID::Dominators, &proc);
+
+    QVERIFY(PassManager::get()->executePass(PassID::UnusedStatementRemoval, &proc));
+
+    QVERIFY(containsStatement(&proc, a1));
+    QVERIFY(containsStatement(&proc, a2));
+    QVERIFY(!containsStatement(&proc, a3));
+    QVERIFY(containsStatement(&proc, a4));
+}
+
+
+void UnusedStatementRemovalPassTest::testRemoveAfterPropagation()
+{
+    Prog prog("test", &m_project);
+    UserProc proc(Address(0x1000), "test", prog.getRootModule());
+
+    // 1 ecx := 5
+    // 2 eax := ecx{1}
+    // 3 m[0x2000] := eax{2}
+    Assign *a1 = new Assign(Location::regOf(REG_PENT_ECX), Const::get(5));
+    Assign *a2 = new Assign(Location::regOf(REG_PENT_EAX),
+                            RefExp::get(Location::regOf(REG_PENT_ECX), a1));
+    Assign *a3 = new Assign(Location::memOf(Const::get(0x2000)),
+                            RefExp::get(Location::regOf(REG_PENT_EAX), a2));
+    ReturnStatement *ret = new ReturnStatement();
+
+    std::unique_ptr<RTLList> bbRTLs(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { a1, a2, a3 })));
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1010), { ret })));
+    proc.getCFG()->createBB(BBType::Ret, std::move(bbRTLs));
+    proc.setEntryBB();
+    proc.setRetStmt(ret, Address(0x1010));
+    PassManager::get()->executePass(PassID::Dominators, &proc);
+
+    QVERIFY(proc.getDefUseChains().isUsed(a2));
+
+    // Propagate 2 into 3 without going through the pass manager:
+    // 3 m[0x2000] := ecx{1}
+    QVERIFY(proc.searchAndReplace(*RefExp::get(Location::regOf(REG_PENT_EAX), a2),
+                                  RefExp::get(Location::regOf(REG_PENT_ECX), a1)));
+    QCOMPARE(*a3->getRight(), *RefExp::get(Location::regOf(REG_PENT_ECX), a1));
+
+    QVERIFY(!proc.getDefUseChains().isUsed(a2));
+    QVERIFY(PassManager::get()->executePass(PassID::UnusedStatementRemoval, &proc));
+
+    QVERIFY(containsStatement(&proc, a1));
+    QVERIFY(!containsStatement(&proc, a2));
+    QVERIFY(containsStatement(&proc, a3));
+}
+
+
+QTEST_GUILESS_MAIN(UnusedStatementRemovalPassTest)
@@ -0,0 +1,26 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "TestUtils.h"
+
+
+/**
+ * Tests for removing unused statements
+ */
+class UnusedStatementRemovalPassTest : public BoomerangTestWithProject
+{
+    Q_OBJECT
+
+private slots:
+    void testRemoveUnused();
+    void testRemoveAfterPropagation(); /// tests propagating outside of the pass manager first
+};
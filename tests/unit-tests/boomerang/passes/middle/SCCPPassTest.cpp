@@ -0,0 +1,180 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "SCCPPassTest.h"
+
+
+#include "boomerang/db/BasicBlock.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/passes/PassManager.h"
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/statements/BranchStatement.h"
+#include "boomerang/ssl/statements/CallStatement.h"
+#include "boomerang/ssl/statements/PhiAssign.h"
+#include "boomerang/ssl/statements/ReturnStatement.h"
+
+
+void SCCPPassTest::testConstantFolding()
+{
+    Prog prog("test", &m_project);
+    UserProc proc(Address(0x1000), "test", prog.getRootModule());
+
+    // 1 eax := 5
+    // 2 ecx := eax{1} + 1
+    // 3 edx := ecx{2} * 2
+    // 4 esi := edi{-} + 1
+    Assign *a1 = new Assign(Location::regOf(REG_PENT_EAX), Const::get(5));
+    Assign *a2 = new Assign(Location::regOf(REG_PENT_ECX),
+                            Binary::get(opPlus, RefExp::get(Location::regOf(REG_PENT_EAX), a1),
+                                        Const::get(1)));
+    Assign *a3 = new Assign(Location::regOf(REG_PENT_EDX),
+                            Binary::get(opMult, RefExp::get(Location::regOf(REG_PENT_ECX), a2),
+                                        Const::get(2)));
+    Assign *a4 = new Assign(Location::regOf(REG_PENT_ESI),
+                            Binary::get(opPlus, RefExp::get(Location::regOf(REG_PENT_EDI), nullptr),
+                                        Const::get(1)));
+    ReturnStatement *ret = new ReturnStatement();
+
+    std::unique_ptr<RTLList> bbRTLs(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { a1, a2, a3, a4 })));
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1010), { ret })));
+    proc.getCFG()->createBB(BBType::Ret, std::move(bbRTLs));
+    proc.setEntryBB();
+    proc.setRetStmt(ret, Address(0x1010));
+
+    QVERIFY(PassManager::get()->executePass(PassID::SCCP, &proc));
+
+    QCOMPARE(*a2->getRight(), *Const::get(6));
+    QCOMPARE(*a3->getRight(), *Const::get(12));
+    QCOMPARE(a4->getRight()->toString(), QString("r31{-} + 1"));
+
+    // nothing left to do
+    QVERIFY(!PassManager::get()->executePass(PassID::SCCP, &proc));
+}
+
+
+void SCCPPassTest::testBranchFolding()
+{
+    Prog prog("test", &m_project);
+    UserProc proc(Address(0x1000), "test", prog.getRootModule());
+
+    // 0x1000: 1 eax := 5
+    //            BRANCH 0x1020, condition eax{1} = 5
+    // 0x1010: 2 eax := 7
+    // 0x1020: 3 eax := phi{1 2}
+    //         4 ecx := eax{3}
+    //           RET
+    Assign *a1 = new Assign(Location::regOf(REG_PENT_EAX), Const::get(5));
+    BranchStatement *branch = new BranchStatement();
+    branch->setDest(Address(0x1020));
+    branch->setCondExpr(Binary::get(opEquals, RefExp::get(Location::regOf(REG_PENT_EAX), a1),
+                                    Const::get(5)));
+
+    std::unique_ptr<RTLList> bbRTLs(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { a1, branch })));
+    BasicBlock *bb1 = proc.getCFG()->createBB(BBType::Twoway, std::move(bbRTLs));
+
+    Assign *a2 = new Assign(Location::regOf(REG_PENT_EAX), Const::get(7));
+    bbRTLs.reset(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1010), { a2 })));
+    BasicBlock *bb2 = proc.getCFG()->createBB(BBType::Fall, std::move(bbRTLs));
+
+    Assign *a4           = new Assign(Location::regOf(REG_PENT_ECX), Const::get(0));
+    ReturnStatement *ret = new ReturnStatement();
+    bbRTLs.reset(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1020), { a4, ret })));
+    BasicBlock *bb3 = proc.getCFG()->createBB(BBType::Ret, std::move(bbRTLs));
+
+    proc.getCFG()->addEdge(bb1, bb3); // taken
+    proc.getCFG()->addEdge(bb1, bb2); // fallthrough
+    proc.getCFG()->addEdge(bb2, bb3);
+    proc.setEntryBB();
+    proc.setRetStmt(ret, Address(0x1020));
+
+    PhiAssign *phi = bb3->addPhi(Location::regOf(REG_PENT_EAX));
+    phi->putAt(bb1, a1, Location::regOf(REG_PENT_EAX));
+    phi->putAt(bb2, a2, Location::regOf(REG_PENT_EAX));
+    a4->setRight(RefExp::get(Location::regOf(REG_PENT_EAX), phi));
+
+    QVERIFY(PassManager::get()->executePass(PassID::SCCP, &proc));
+
+    QCOMPARE(proc.getCFG()->getNumBBs(), 2);
+    QVERIFY(!proc.getCFG()->hasBB(bb2));
+
+    QVERIFY(bb1->isType(BBType::Oneway));
+    QCOMPARE(bb1->getNumSuccessors(), 1);
+    QVERIFY(bb1->getSuccessor(0) == bb3);
+    QCOMPARE(bb3->getNumPredecessors(), 1);
+    QVERIFY(bb3->getPredecessor(0) == bb1);
+
+    QCOMPARE(*a4->getRight(), *Const::get(5));
+}
+
+
+void SCCPPassTest::testRemoveUnreachableCall()
+{
+    Prog prog("test", &m_project);
+    UserProc proc(Address(0x1000), "test", prog.getRootModule());
+    UserProc callee(Address(0x2000), "callee", prog.getRootModule());
+
+    // 0x1000: 1 eax := 0
+    //            BRANCH 0x1020, condition eax{1} = 0
+    // 0x1010: 2 CALL callee()
+    // 0x1020:   RET
+    Assign *a1 = new Assign(Location::regOf(REG_PENT_EAX), Const::get(0));
+    BranchStatement *branch = new BranchStatement();
+    branch->setDest(Address(0x1020));
+    branch->setCondExpr(Binary::get(opEquals, RefExp::get(Location::regOf(REG_PENT_EAX), a1),
+                                    Const::get(0)));
+
+    std::unique_ptr<RTLList> bbRTLs(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { a1, branch })));
+    BasicBlock *bb1 = proc.getCFG()->createBB(BBType::Twoway, std::move(bbRTLs));
+
+    CallStatement *call = new CallStatement();
+    call->setDest(Address(0x2000));
+    call->setDestProc(&callee);
+    callee.addCaller(call);
+
+    bbRTLs.reset(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1010), { call })));
+    BasicBlock *bb2 = proc.getCFG()->createBB(BBType::Call, std::move(bbRTLs));
+
+    ReturnStatement *ret = new ReturnStatement();
+    bbRTLs.reset(new RTLList);
+    bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1020), { ret })));
+    BasicBlock *bb3 = proc.getCFG()->createBB(BBType::Ret, std::move(bbRTLs));
+
+    proc.getCFG()->addEdge(bb1, bb3); // taken
+    proc.getCFG()->addEdge(bb1, bb2); // fallthrough
+    proc.getCFG()->addEdge(bb2, bb3);
+    proc.setEntryBB();
+    proc.setRetStmt(ret, Address(0x1020));
+
+    QCOMPARE(callee.getCallers().size(), static_cast<size_t>(1));
+
+    QVERIFY(PassManager::get()->executePass(PassID::SCCP, &proc));
+
+    QCOMPARE(proc.getCFG()->getNumBBs(), 2);
+    QVERIFY(!proc.getCFG()->hasBB(bb2));
+    QVERIFY(bb1->isType(BBType::Oneway));
+
+    // the call was deleted together with its BB
+    QVERIFY(callee.getCallers().empty());
+}
+
+
+QTEST_GUILESS_MAIN(SCCPPassTest)
@@ -0,0 +1,27 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "TestUtils.h"
+
+
+/**
+ * Tests for sparse conditional constant propagation
+ */
+class SCCPPassTest : public BoomerangTestWithProject
+{
+    Q_OBJECT
+
+private slots:
+    void testConstantFolding();
+    void testBranchFolding(); /// tests folding a constant branch condition and removing the dead BB
+    void testRemoveUnreachableCall(); /// tests removing a dead BB containing a call
+};
@@ -0,0 +1,56 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "CancellationTokenTest.h"
+
+
+#include "boomerang/util/CancellationToken.h"
+
+#include <QThread>
+
+
+void CancellationTokenTest::testCancel()
+{
+    CancellationToken token;
+    QVERIFY(!token.isCancelled());
+
+    token.cancel();
+    QVERIFY(token.isCancelled());
+}
+
+
+void CancellationTokenTest::testTimeout()
+{
+    CancellationToken token;
+
+    token.setTimeout(std::chrono::hours(1));
+    QVERIFY(!token.isCancelled());
+
+    token.setTimeout(std::chrono::milliseconds(10));
+    QThread::msleep(20);
+    QVERIFY(token.isCancelled());
+}
+
+
+void CancellationTokenTest::testReset()
+{
+    CancellationToken token;
+
+    token.cancel();
+    token.reset();
+    QVERIFY(!token.isCancelled());
+
+    token.setTimeout(std::chrono::milliseconds(0));
+    QVERIFY(token.isCancelled());
+    token.reset();
+    QVERIFY(!token.isCancelled());
+}
+
+
+QTEST_GUILESS_MAIN(CancellationTokenTest)
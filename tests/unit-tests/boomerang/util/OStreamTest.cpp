@@ -0,0 +1,145 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "OStreamTest.h"
+
+
+#include "boomerang/util/OStream.h"
+
+#include <QTemporaryFile>
+#include <QTextStream>
+
+#include <climits>
+#include <limits>
+
+
+/// Write the same output to a QTextStream and an OStream and compare the results
+#define COMPARE_OUTPUT(output)                                                                     \
+    {                                                                                              \
+        QString expected;                                                                          \
+        QString actual;                                                                            \
+        {                                                                                          \
+            QTextStream expectedStream(&expected);                                                 \
+            expectedStream << output;                                                              \
+        }                                                                                          \
+        {                                                                                          \
+            OStream actualStream(&actual);                                                         \
+            actualStream << output;                                                                \
+        }                                                                                          \
+        QCOMPARE(actual, expected);                                                                \
+    }
+
+
+/// \returns the UTF-8 encoded contents written by \p write to a file
+template<typename Func>
+static QByteArray writeToFile(Func write)
+{
+    QTemporaryFile file;
+    if (!file.open()) {
+        return QByteArray();
+    }
+
+    {
+        OStream os(&file);
+        write(os);
+    }
+
+    file.seek(0);
+    return file.readAll();
+}
+
+
+void OStreamTest::testPadding()
+{
+    COMPARE_OUTPUT(qSetFieldWidth(8) << "abc" << qSetFieldWidth(0) << "|");
+    COMPARE_OUTPUT(qSetFieldWidth(8) << QString("abc") << 'd' << qSetFieldWidth(0) << "|");
+    COMPARE_OUTPUT(qSetFieldWidth(2) << "abcdef");
+    COMPARE_OUTPUT(qSetPadChar('0') << qSetFieldWidth(6) << 42 << -42);
+    COMPARE_OUTPUT(qSetPadChar('.') << qSetFieldWidth(10) << 1.5 << qSetFieldWidth(0) << 1.5);
+    COMPARE_OUTPUT(qSetFieldWidth(4) << qSetPadChar(QChar(0xE4)) << "a");
+
+    QVERIFY(writeToFile([](OStream &os) { os << qSetFieldWidth(4) << "ab"; }) == "  ab");
+    QVERIFY(writeToFile([](OStream &os) {
+                os << qSetFieldWidth(3) << qSetPadChar(QChar(0x20AC)) << "a";
+            }) == "\xE2\x82\xAC\xE2\x82\xAC" "a");
+}
+
+
+void OStreamTest::testIntegers()
+{
+    COMPARE_OUTPUT(0);
+    COMPARE_OUTPUT(42);
+    COMPARE_OUTPUT(-42);
+    COMPARE_OUTPUT(INT_MAX);
+    COMPARE_OUTPUT(INT_MIN);
+    COMPARE_OUTPUT(static_cast<unsigned int>(UINT_MAX));
+    COMPARE_OUTPUT(static_cast<uint64>(0));
+    COMPARE_OUTPUT(std::numeric_limits<uint64>::max());
+
+    QVERIFY(writeToFile([](OStream &os) { os << INT_MIN << ' ' << 7U; }) == "-2147483648 7");
+}
+
+
+void OStreamTest::testHexNumber()
+{
+    QString actual;
+    {
+        OStream os(&actual);
+        os << HexNumber(0) << " " << HexNumber(0xABC) << " " << HexNumber(0x1F, 4) << " "
+           << HexNumber(0x12345, 2) << " " << HexNumber(std::numeric_limits<uint64>::max());
+    }
+
+    QCOMPARE(actual, QString("0 abc 001f 12345 ffffffffffffffff"));
+
+    actual.clear();
+    {
+        OStream os(&actual);
+        os << qSetFieldWidth(6) << HexNumber(0xFF) << qSetFieldWidth(0) << "|";
+    }
+
+    QCOMPARE(actual, QString("    ff|"));
+}
+
+
+void OStreamTest::testDoubles()
+{
+    COMPARE_OUTPUT(0.0);
+    COMPARE_OUTPUT(1.5);
+    COMPARE_OUTPUT(-2.25);
+    COMPARE_OUTPUT(1.0 / 3.0);
+    COMPARE_OUTPUT(123456789.0);
+    COMPARE_OUTPUT(1e-10);
+    COMPARE_OUTPUT(1e+100);
+    COMPARE_OUTPUT(qSetRealNumberPrecision(3) << 1.0 / 3.0 << " " << 1234.5);
+    COMPARE_OUTPUT(qSetRealNumberPrecision(12) << 1.0 / 3.0);
+
+    QString actual;
+    {
+        OStream os(&actual);
+        os << 1.0 / 3.0 << " " << 1e+06;
+    }
+
+    QCOMPARE(actual, QString("0.333333 1e+06"));
+}
+
+
+void OStreamTest::testLatin1()
+{
+    // char and const char * are Latin-1
+    COMPARE_OUTPUT("a\xE4" << '\xF6');
+    COMPARE_OUTPUT(QString::fromUtf8("\xE2\x82\xAC"));
+
+    QVERIFY(writeToFile([](OStream &os) { os << "a\xE4"; }) == "a\xC3\xA4");
+    QVERIFY(writeToFile([](OStream &os) { os << '\xF6'; }) == "\xC3\xB6");
+    QVERIFY(writeToFile([](OStream &os) { os << QString::fromUtf8("\xE2\x82\xAC"); }) ==
+            "\xE2\x82\xAC");
+}
+
+
+QTEST_GUILESS_MAIN(OStreamTest)
@@ -92,6 +92,39 @@ void UtilTest::testRead()
 }
 
 
+void UtilTest::testReadArray()
+{
+    // large enough to not fit into a single vector register, and not a multiple of its size
+    Byte buffer[8 * 37 + 1];
+    for (std::size_t i = 0; i < sizeof(buffer); i++) {
+        buffer[i] = static_cast<Byte>(i * 7 + 3);
+    }
+
+    for (Endian endian : { Endian::Little, Endian::Big }) {
+        SWord words[4 * 37];
+        DWord dwords[2 * 37];
+        QWord qwords[37];
+
+        // unaligned source
+        Util::readWords(words, buffer + 1, 4 * 37, endian);
+        Util::readDWords(dwords, buffer + 1, 2 * 37, endian);
+        Util::readQWords(qwords, buffer + 1, 37, endian);
+
+        for (int i = 0; i < 4 * 37; i++) {
+            QCOMPARE(words[i], Util::readWord(buffer + 1 + 2 * i, endian));
+        }
+
+        for (int i = 0; i < 2 * 37; i++) {
+            QCOMPARE(dwords[i], Util::readDWord(buffer + 1 + 4 * i, endian));
+        }
+
+        for (int i = 0; i < 37; i++) {
+            QCOMPARE(qwords[i], Util::readQWord(buffer + 1 + 8 * i, endian));
+        }
+    }
+}
+
+
 void UtilTest::testWrite()
 {
     const Byte expectedBuffer[8] = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88 };
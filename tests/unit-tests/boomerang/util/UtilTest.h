@@ -25,6 +25,7 @@ private slots:
     void testSwapEndian();
     void testNormEndian();
     void testRead();
+    void testReadArray();
     void testWrite();
     void testSignExtend();
 };